@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -158,6 +160,68 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get counters of the threads executing infer requests of an executable network.
+ *
+ * String value is "STREAMS_EXECUTOR_STATISTICS". Maps a counter name ("QUEUE_DEPTH", "EXECUTED_TASKS",
+ * "STOLEN_TASKS", "IDLE_TIME_US") to a vector of its values, one per stream
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(STREAMS_EXECUTOR_STATISTICS, std::map<std::string, std::vector<uint64_t>>);
+
+/**
+ * @brief Metric to get the amount of executable network memory placed on the NUMA nodes of the streams using it.
+ *
+ * String value is "NUMA_MEMORY_STATISTICS". Maps "LOCAL_BYTES" and "REMOTE_BYTES" to the number of bytes
+ * on the stream NUMA node and on the other nodes. Only memory of streams bound to NUMA nodes is counted
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMA_MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get the number of inferences which used the user input and output blobs directly.
+ *
+ * String value is "ZERO_COPY_STATISTICS". Maps an input or output name to the number of inferences
+ * which bound the user blob as the device memory ("ZERO_COPY") and which copied the data ("COPIED").
+ * A blob is bound if its precision and layout match the device memory and no mean image or dynamic batch is used
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(ZERO_COPY_STATISTICS, std::map<std::string, std::map<std::string, uint64_t>>);
+
+/**
+ * @brief Metric to get the statistics of the infer requests scheduled to the devices of the MULTI executable network.
+ *
+ * String value is "DEVICE_SCHEDULING_STATISTICS". Maps a device name to its "LATENCY_MS" (moving average),
+ * "THROUGHPUT_FPS" (since the network was loaded), "COMPLETED_REQUESTS" and "REQUESTS_IN_FLIGHT"
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(DEVICE_SCHEDULING_STATISTICS, std::map<std::string, std::map<std::string, double>>);
+
+/**
+ * @brief Metric which defines support of import / export functionality by plugin.
+ *
+ * String value is "IMPORT_EXPORT_SUPPORT". Core uses it to decide whether networks loaded to the device
+ * can be stored in the compiled networks cache (see CONFIG_KEY(CACHE_DIR))
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
+/**
+ * @brief Metric to get a number of networks imported from the compiled networks cache for a device.
+ *
+ * String value is "NUMBER_OF_CACHE_HITS". The metric is maintained by Core and available for any device
+ */
+DECLARE_METRIC_KEY(NUMBER_OF_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get a number of networks compiled and stored to the compiled networks cache for a device.
+ *
+ * String value is "NUMBER_OF_CACHE_MISSES". The metric is maintained by Core and available for any device
+ */
+DECLARE_METRIC_KEY(NUMBER_OF_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get a total compilation time in milliseconds saved by importing networks from the cache.
+ *
+ * String value is "CACHE_COMPILE_TIME_SAVED". The metric is maintained by Core and available for any device
+ */
+DECLARE_METRIC_KEY(CACHE_COMPILE_TIME_SAVED, float);
+
 }  // namespace Metrics
 
 /**
@@ -350,6 +414,16 @@ DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
  */
 DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
 
+/**
+ * @brief This key enables the timeline tracing of the inference.
+ *
+ * Value is a path of the Chrome trace JSON file which can be opened in chrome://tracing or Perfetto UI.
+ * The trace shows the time infer requests spend in the executor queues, the pipeline stages of the requests
+ * and the executed layers. The file is written at the process exit. The tracer is process wide and can also
+ * be enabled with the IE_TRACE_FILE environment variable. Empty string (default) doesn't enable tracing.
+ */
+DECLARE_CONFIG_KEY(TRACE_FILE);
+
 
 /**
  * @brief The name for setting to execute in bfloat16 precision whenever it is possible
@@ -362,6 +436,28 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The key enables inter-operator parallelism inside a single inference (CPU only).
+ *
+ * Independent branches of the network are executed concurrently, each operation still uses
+ * intra-operator parallelism. The option mostly helps latency oriented scenarios (a single stream)
+ * for networks with wide independent branches and small operations.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLELISM);
+
+/**
+ * @brief The key enables collecting of per-operation hardware performance counters (CPU only, Linux perf_event).
+ *
+ * Cycles, instructions, last level cache misses and CPU time of all the threads are collected for each operation
+ * and averaged over the inferences together with the estimated memory traffic of the operation. The values are
+ * reported in the runtime info of the executable graph, the CPU time is reported as cpu_uSec of the performance counts.
+ * The counters cover all the threads of the process, so the option forces a single stream (CPU_THROUGHPUT_STREAMS is 1)
+ * and operations are executed sequentially. The activity of the other networks running at the same time is counted too.
+ * This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_HW_PERF_COUNTERS);
+
 /**
 * @brief This key defines the directory which will be used to store any data cached by plugins.
 *
@@ -372,6 +468,10 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 * The key might enable caching for all plugin or some specific ones, e.g.:
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}) - enables cache for all plugins that might want to use it
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}, {"GPU"}) - enables cache only for GPU plugin
+*
+* The key is handled by Core: networks loaded to devices which report METRIC_KEY(IMPORT_EXPORT_SUPPORT)
+* are exported to the cache directory after compilation and imported from it on subsequent LoadNetwork calls
+* with the same network, device and configuration. The key can also be passed to Core::LoadNetwork.
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
@@ -26,6 +26,8 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -34,5 +36,30 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Number of individual infer requests combined into a single inference of the network reshaped to this batch.
+ *
+ * The network inputs and outputs must have the batch of 1 in the outer dimension. Default value is "1" (no batching).
+ */
+DECLARE_MULTI_CONFIG_KEY(BATCH_SIZE);
+
+/**
+ * @brief Maximum time in milliseconds a request waits for the other requests to complete the batch.
+ *
+ * When the time is over the collected requests are inferred as a partially filled batch. Default value is "1".
+ */
+DECLARE_MULTI_CONFIG_KEY(BATCH_TIMEOUT);
+
+/**
+ * @brief The policy of selecting a device for the infer request
+ *
+ * MULTI_SCHEDULE_BY_PRIORITY (default) selects the first device in the DEVICE_PRIORITIES with an idle request.
+ * MULTI_SCHEDULE_BY_LATENCY selects the device with the lowest expected completion time, which is estimated from
+ * the moving average latency of the device and the number of the requests in flight and waiting for the device.
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(SCHEDULE_BY_PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(SCHEDULE_BY_LATENCY);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
@@ -37,6 +37,17 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop request rate
+static const char request_rate_message[] = "Optional. Enable open-loop mode: requests arrive at the given rate (requests per second) "
+                                           "independently of completion and wait in a queue while all infer requests are busy. "
+                                           "Reported latency percentiles are split into queueing delay and inference time. "
+                                           "Default value is 0 (closed-loop mode, a new request starts when a previous one completes). "
+                                           "Supported only for the async API.";
+
+/// @brief message for open-loop arrival process
+static const char arrival_message[] = "Optional. Arrival process of the open-loop mode: \"poisson\" (exponential inter-arrival times, default) "
+                                      "or \"constant\" (fixed inter-arrival time).";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -147,6 +158,12 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Request rate of the open-loop mode, 0 means closed-loop mode
+DEFINE_double(rate, 0.0, request_rate_message);
+
+/// @brief Arrival process of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -219,6 +236,8 @@ static void showUsage() {
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << request_rate_message << std::endl;
+    std::cout << "    -arrival \"<process>\"      " << arrival_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
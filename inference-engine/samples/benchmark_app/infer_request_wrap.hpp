@@ -43,6 +43,14 @@ public:
 
     void startAsync() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.StartAsync();
+    }
+
+    /// @brief Starts the request which arrived at arrivalTime and was waiting in the queue since then
+    void startAsync(Time::time_point arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
@@ -52,6 +60,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -70,14 +79,31 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueingTimeInMilliseconds() const {
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueTime.count()) * 0.000001;
+    }
+
+    Time::time_point getEndTime() const {
+        return _endTime;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
     QueueCallbackFunction _callbackQueue;
 };
 
+/// @brief Timings of a completed request
+struct RequestRecord {
+    Time::time_point endTime;
+    double latency;        // inference time, ms
+    double queueingTime;   // time between the request arrival and start, ms
+};
+
 class InferRequestsQueue final {
 public:
     InferRequestsQueue(InferenceEngine::ExecutableNetwork& net, size_t nireq) {
@@ -102,6 +128,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _records.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -112,6 +139,7 @@ public:
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _records.push_back({requests.at(id)->getEndTime(), latency, requests.at(id)->getQueueingTimeInMilliseconds()});
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -135,6 +163,10 @@ public:
         return _latencies;
     }
 
+    std::vector<RequestRecord> getRecords() {
+        return _records;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +176,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<RequestRecord> _records;
 };
@@ -4,9 +4,14 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <iomanip>
 #include <memory>
 #include <map>
+#include <random>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -67,6 +72,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("Incorrect request rate. Please set -rate option to a positive value or 0 for closed-loop mode.");
+    }
+
+    if (FLAGS_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-rate option) is supported only for async API.");
+    }
+
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `poisson` or `constant` value.");
+    }
+
     return true;
 }
 
@@ -103,6 +120,54 @@ T getMedianValue(const std::vector<T> &vec) {
            (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
 
+/// @brief Nearest-rank percentile, sortedVec has to be sorted in the ascending order
+template <typename T>
+T getPercentileValue(const std::vector<T> &sortedVec, double percentile) {
+    if (sortedVec.empty())
+        return static_cast<T>(0);
+    size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(std::max(rank, static_cast<size_t>(1)), sortedVec.size()) - 1];
+}
+
+static const std::vector<std::pair<std::string, double>> reportedPercentiles = {
+    {"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0}, {"p99.9", 99.9}
+};
+
+static std::string percentilesToString(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2);
+    for (auto& percentile : reportedPercentiles) {
+        ss << (ss.str().empty() ? "" : ", ") << percentile.first << " " << getPercentileValue(values, percentile.second);
+    }
+    return ss.str();
+}
+
+/// @brief Groups the completed requests by the second of the measurement they were completed within
+static std::vector<StatisticsReport::TimelineEntry> getTimeline(const std::vector<RequestRecord>& records,
+                                                                Time::time_point startTime, size_t batchSize) {
+    std::map<size_t, std::vector<const RequestRecord*>> perSecond;
+    for (auto& record : records) {
+        auto sinceStart = std::chrono::duration_cast<std::chrono::seconds>(record.endTime - startTime).count();
+        perSecond[static_cast<size_t>(std::max<decltype(sinceStart)>(sinceStart, 0))].push_back(&record);
+    }
+
+    std::vector<StatisticsReport::TimelineEntry> timeline;
+    for (auto& second : perSecond) {
+        std::vector<double> latencies;
+        double queueing = 0.0;
+        for (auto record : second.second) {
+            latencies.push_back(record->latency);
+            queueing += record->queueingTime;
+        }
+        std::sort(latencies.begin(), latencies.end());
+        timeline.push_back({second.first, latencies.size(), static_cast<double>(latencies.size() * batchSize),
+                            getPercentileValue(latencies, 50.0), getPercentileValue(latencies, 99.0),
+                            queueing / latencies.size()});
+    }
+    return timeline;
+}
+
 /**
 * @brief The entry point of the benchmark application
 */
@@ -441,9 +506,12 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        // Open-loop mode: requests arrive independently of completion, so the iterations are not aligned by requests
+        const bool openLoop = FLAGS_rate > 0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -502,6 +570,9 @@ int main(int argc, char *argv[]) {
                 ss << ", ";
             }
             ss << nireq << " inference requests";
+            if (openLoop) {
+                ss << ", " << FLAGS_arrival << " arrivals at " << FLAGS_rate << " requests per second";
+            }
             std::stringstream device_ss;
             for (auto& nstreams : device_nstreams) {
                 if (!device_ss.str().empty()) {
@@ -551,13 +622,25 @@ int main(int argc, char *argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // arrival schedule of the open-loop mode, the requests which are late wait in the queue
+        std::mt19937 arrivalGenerator(0);
+        std::exponential_distribution<double> poissonInterval(openLoop ? FLAGS_rate : 1.0);
+        auto nextArrivalInterval = [&] () {
+            double seconds = FLAGS_arrival == "poisson" ? poissonInterval(arrivalGenerator) : 1.0 / FLAGS_rate;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+        auto arrivalTime = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -572,7 +655,12 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(arrivalTime);
+                    arrivalTime += nextArrivalInterval();
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -594,6 +682,12 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
+        auto records = inferRequestsQueue.getRecords();
+        std::vector<double> queueingTimes, totalTimes;
+        for (auto& record : records) {
+            queueingTimes.push_back(record.queueingTime);
+            totalTimes.push_back(record.queueingTime + record.latency);
+        }
         double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
@@ -609,6 +703,14 @@ int main(int argc, char *argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
+                                                  {"latency percentiles (ms)", percentilesToString(inferRequestsQueue.getLatencies())},
+                                          });
+            }
+            if (openLoop) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"queueing delay percentiles (ms)", percentilesToString(queueingTimes)},
+                                                  {"total latency percentiles (ms)", percentilesToString(totalTimes)},
                                           });
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -654,13 +756,21 @@ int main(int argc, char *argv[]) {
             }
         }
 
-        if (statistics)
+        if (statistics) {
             statistics->dump();
+            statistics->dumpTimeline(getTimeline(records, startTime, batchSize));
+        }
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "            " << percentilesToString(inferRequestsQueue.getLatencies()) << " ms" << std::endl;
+        }
+        if (openLoop) {
+            std::cout << "Queueing:   " << percentilesToString(queueingTimes) << " ms" << std::endl;
+            std::cout << "Total:      " << percentilesToString(totalTimes) << " ms" << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
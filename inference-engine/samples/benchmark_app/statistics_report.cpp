@@ -132,3 +132,22 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpTimeline(const std::vector<TimelineEntry> &timeline) {
+    if (timeline.empty()) {
+        slog::info << "Timeline is empty. No reports are dumped." << slog::endl;
+        return;
+    }
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_timeline_report.csv");
+
+    dumper << "second" << "completed requests" << "throughput";
+    dumper << "latency median (ms)" << "latency p99 (ms)" << "queueing avg (ms)";
+    dumper.endLine();
+
+    for (const auto &entry : timeline) {
+        dumper << entry.second << entry.count << entry.throughput;
+        dumper << entry.latencyMedian << entry.latency99 << entry.queueingAvg;
+        dumper.endLine();
+    }
+    slog::info << "Timeline report is stored to " << dumper.getFilename() << slog::endl;
+}
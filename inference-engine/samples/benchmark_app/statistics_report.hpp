@@ -30,6 +30,16 @@ public:
         std::string report_folder;
     };
 
+    /// @brief Requests completed within one second of the measurement
+    struct TimelineEntry {
+        size_t second;
+        size_t count;
+        double throughput;
+        double latencyMedian;
+        double latency99;
+        double queueingAvg;
+    };
+
     enum class Category {
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
@@ -57,6 +67,8 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    void dumpTimeline(const std::vector<TimelineEntry> &timeline);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
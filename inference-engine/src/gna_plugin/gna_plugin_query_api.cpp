@@ -47,6 +47,7 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
             return deviceName;
         }},
         {METRIC_KEY(GNA_LIBRARY_FULL_VERSION), [this]() {return GNADeviceHelper::GetGnaLibraryVersion();}},
+        {METRIC_KEY(IMPORT_EXPORT_SUPPORT), []() {return true;}},
         {METRIC_KEY(SUPPORTED_METRICS), [&queryApiSupported, this]() {
             std::vector<std::string> availablesMetrics;
             for (auto && supportedAPI : queryApiSupported) {
@@ -9,6 +9,7 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -33,17 +34,22 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    GNAPluginNS::runtime::ParallelForRows(num_filter_outputs, num_filters * num_filter_coefficients, [&](size_t begin, size_t end) {
+        using GNAPluginNS::runtime::kMaxDotProducts;
+        float sums[kMaxDotProducts];
+        for (size_t j = begin; j < end; j++) {
+            const float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+            for (uint32_t i = 0; i < num_filters; i += kMaxDotProducts) {
+                const size_t num_sums = (std::min)(kMaxDotProducts, static_cast<size_t>(num_filters - i));
+                GNAPluginNS::runtime::DotProducts(ptr_in, ptr_filters + i * num_filter_coefficients, num_filter_coefficients,
+                                                  num_sums, num_filter_coefficients, sums);
+                for (size_t f = 0; f < num_sums; f++) {
+                    ptr_outputs[j * num_filters + i + f] = ptr_biases[i + f] + sums[f];
+                }
             }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
         }
-    }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -185,51 +191,6 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
 
 #if GNA_LIB_VER == 2
 
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
-    if (paddedIndex >= inputSize + 2 * paddingSize) {
-        THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
-    }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
-}
-
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
-}
-
 void CNN2DFilter32(intel_dnn_component_t* component) {
     float* ptr_filters = reinterpret_cast<float*>(component->op.conv2D.ptr_filters);
     float* ptr_biases = reinterpret_cast<float*>(component->op.conv2D.ptr_biases);
@@ -258,21 +219,53 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+    if ((OH > 0 && (OH - 1) * cSH + kh > IH + 2 * zPH) || (OW > 0 && (OW - 1) * cSW + kw > IW + 2 * zPW)) {
+        THROW_GNA_EXCEPTION << "Output size doesn't match the padded input size!" << layer_name;
+    }
+
+    // kernel padded to 16B = 4 * sizeof(float)
+    const size_t kernelStride = ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    GNAPluginNS::runtime::ParallelForRows(OH * OW, OC * kh * kw * kc, [&](size_t begin, size_t end) {
+        using GNAPluginNS::runtime::kMaxDotProducts;
+        float sums[kMaxDotProducts];
+        for (size_t ohw = begin; ohw < end; ohw++) {
+            const uint32_t oh = ohw / OW;
+            const uint32_t ow = ohw % OW;
+            float* output = ptr_outputs + getQubeIndex<size_t>(oh, ow, 0, OW, OC);
+            std::copy_n(ptr_biases, OC, output);
+
+            // the kernel rows are cut by the zero padding, the rest of a row is contiguous in HWC layout
+            const int64_t imageH = static_cast<int64_t>(cSH) * oh - zPH;
+            const int64_t imageW = static_cast<int64_t>(cSW) * ow - zPW;
+            const uint32_t firstKW = static_cast<uint32_t>((std::max)(int64_t{0}, -imageW));
+            const uint32_t endKW = static_cast<uint32_t>((std::min)(static_cast<int64_t>(kw), IW - imageW));
+            if (firstKW >= endKW) {
+                continue;
+            }
+            for (uint32_t kRow = 0; kRow < kh; kRow++) {
+                const int64_t ih = imageH + kRow;
+                if (ih < 0 || ih >= IH) {
+                    continue;
+                }
+                const float* image = ptr_inputs + getQubeIndex<size_t>(ih, imageW + firstKW, 0, IW, IC);
+                const float* filters = ptr_filters + getQubeIndex<size_t>(kRow, firstKW, 0, kw, kc);
+                for (uint32_t oc = 0; oc < OC; oc += kMaxDotProducts) {
+                    const size_t numSums = (std::min)(kMaxDotProducts, static_cast<size_t>(OC - oc));
+                    GNAPluginNS::runtime::DotProducts(image, filters + oc * kernelStride, kernelStride,
+                                                      numSums, (endKW - firstKW) * kc, sums);
+                    for (size_t f = 0; f < numSums; f++) {
+                        output[oc + f] += sums[f];
+                    }
+                }
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
@@ -0,0 +1,67 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx2.hpp"
+
+#include <immintrin.h>  // AVX2, FMA
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+static inline float mm256_hsum(__m256 x) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    return _mm_cvtss_f32(s);
+}
+
+// two accumulators per product hide the latency of FMA
+template <size_t NB>
+static void dot_products(const float *a, const float *b, size_t ldb, size_t k, float *sums) {
+    __m256 acc0[NB], acc1[NB];
+    for (size_t j = 0; j < NB; j++) {
+        acc0[j] = _mm256_setzero_ps();
+        acc1[j] = _mm256_setzero_ps();
+    }
+
+    size_t i = 0;
+    for (; i + 16 <= k; i += 16) {
+        const __m256 a0 = _mm256_loadu_ps(a + i);
+        const __m256 a1 = _mm256_loadu_ps(a + i + 8);
+        for (size_t j = 0; j < NB; j++) {
+            acc0[j] = _mm256_fmadd_ps(a0, _mm256_loadu_ps(b + j * ldb + i), acc0[j]);
+            acc1[j] = _mm256_fmadd_ps(a1, _mm256_loadu_ps(b + j * ldb + i + 8), acc1[j]);
+        }
+    }
+    if (i + 8 <= k) {
+        const __m256 a0 = _mm256_loadu_ps(a + i);
+        for (size_t j = 0; j < NB; j++) {
+            acc0[j] = _mm256_fmadd_ps(a0, _mm256_loadu_ps(b + j * ldb + i), acc0[j]);
+        }
+        i += 8;
+    }
+
+    for (size_t j = 0; j < NB; j++) {
+        float sum = mm256_hsum(_mm256_add_ps(acc0[j], acc1[j]));
+        for (size_t t = i; t < k; t++) {
+            sum += a[t] * b[j * ldb + t];
+        }
+        sums[j] = sum;
+    }
+}
+
+void DotProducts(const float *a, const float *b, size_t ldb, size_t num_b, size_t k, float *sums) {
+    switch (num_b) {
+    case 1: dot_products<1>(a, b, ldb, k, sums); break;
+    case 2: dot_products<2>(a, b, ldb, k, sums); break;
+    case 3: dot_products<3>(a, b, ldb, k, sums); break;
+    case 4: dot_products<4>(a, b, ldb, k, sums); break;
+    default: break;
+    }
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,18 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+// see GNAPluginNS::runtime::DotProducts()
+void DotProducts(const float *a, const float *b, size_t ldb, size_t num_b, size_t k, float *sums);
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx512.hpp"
+
+#include <immintrin.h>  // AVX512F
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx512 {
+
+// two accumulators per product hide the latency of FMA, the tail is computed with a masked load
+template <size_t NB>
+static void dot_products(const float *a, const float *b, size_t ldb, size_t k, float *sums) {
+    __m512 acc0[NB], acc1[NB];
+    for (size_t j = 0; j < NB; j++) {
+        acc0[j] = _mm512_setzero_ps();
+        acc1[j] = _mm512_setzero_ps();
+    }
+
+    size_t i = 0;
+    for (; i + 32 <= k; i += 32) {
+        const __m512 a0 = _mm512_loadu_ps(a + i);
+        const __m512 a1 = _mm512_loadu_ps(a + i + 16);
+        for (size_t j = 0; j < NB; j++) {
+            acc0[j] = _mm512_fmadd_ps(a0, _mm512_loadu_ps(b + j * ldb + i), acc0[j]);
+            acc1[j] = _mm512_fmadd_ps(a1, _mm512_loadu_ps(b + j * ldb + i + 16), acc1[j]);
+        }
+    }
+    for (; i < k; i += 16) {
+        const __mmask16 mask = k - i >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << (k - i)) - 1);
+        const __m512 a0 = _mm512_maskz_loadu_ps(mask, a + i);
+        for (size_t j = 0; j < NB; j++) {
+            acc0[j] = _mm512_fmadd_ps(a0, _mm512_maskz_loadu_ps(mask, b + j * ldb + i), acc0[j]);
+        }
+    }
+
+    for (size_t j = 0; j < NB; j++) {
+        sums[j] = _mm512_reduce_add_ps(_mm512_add_ps(acc0[j], acc1[j]));
+    }
+}
+
+void DotProducts(const float *a, const float *b, size_t ldb, size_t num_b, size_t k, float *sums) {
+    switch (num_b) {
+    case 1: dot_products<1>(a, b, ldb, k, sums); break;
+    case 2: dot_products<2>(a, b, ldb, k, sums); break;
+    case 3: dot_products<3>(a, b, ldb, k, sums); break;
+    case 4: dot_products<4>(a, b, ldb, k, sums); break;
+    default: break;
+    }
+}
+
+}  // namespace avx512
+}  // namespace runtime
+}  // namespace GNAPluginNS
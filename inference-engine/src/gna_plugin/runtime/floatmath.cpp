@@ -1,14 +1,110 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software emulation,
+// the hot paths are blocked, vectorized and computed in parallel over output rows
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
 
+#include <ie_system_conf.h>
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/floatmath_avx512.hpp"
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+
+namespace {
+
+void DotProductsRef(const float *a, const float *b, size_t ldb, size_t num_b, size_t k, float *sums) {
+    for (size_t j = 0; j < num_b; j++) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < k; i++) {
+            sum += a[i] * b[j * ldb + i];
+        }
+        sums[j] = sum;
+    }
+}
+
+}  // namespace
+
+void DotProducts(const float *a, const float *b, size_t ldb, size_t num_b, size_t k, float *sums) {
+    using DotProductsFn = void (*)(const float *, const float *, size_t, size_t, size_t, float *);
+    static const DotProductsFn impl = []() -> DotProductsFn {
+#ifdef HAVE_AVX512
+        if (InferenceEngine::with_cpu_x86_avx512f()) return avx512::DotProducts;
+#endif
+#ifdef HAVE_AVX2
+        if (InferenceEngine::with_cpu_x86_avx2()) return avx2::DotProducts;
+#endif
+        return DotProductsRef;
+    }();
+    impl(a, b, ldb, num_b, k, sums);
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
+
+using GNAPluginNS::runtime::DotProducts;
+using GNAPluginNS::runtime::kMaxDotProducts;
+using GNAPluginNS::runtime::ParallelForRows;
+
+namespace {
+
+// the block of K of up to kMaxDotProducts packed columns of B stays in L1 cache while it's used by the rows of A
+constexpr size_t kBlockK = 1024;
+
+// C[l, :] += A[rows[l], :] * B for l < L, rows of A are taken one by one if the list is null
+void sgemm_nn_blocked(const MKL_INT L, const MKL_INT N, const MKL_INT K, const float *A, const MKL_INT lda,
+                      const uint32_t *rows, const float *B, const MKL_INT ldb, float *C, const MKL_INT ldc) {
+    // columns of B are packed to make the dot products contiguous
+    std::vector<float> packed;
+    const float *cols = B;
+    if (N != 1 || ldb != 1) {
+        packed.resize(static_cast<size_t>(N) * K);
+        for (MKL_INT k = 0; k < K; k++) {
+            for (MKL_INT j = 0; j < N; j++) {
+                packed[static_cast<size_t>(j) * K + k] = B[static_cast<size_t>(k) * ldb + j];
+            }
+        }
+        cols = packed.data();
+    }
+
+    ParallelForRows(L, static_cast<size_t>(N) * K, [&](size_t begin, size_t end) {
+        float sums[kMaxDotProducts];
+        for (size_t k0 = 0; k0 < static_cast<size_t>(K); k0 += kBlockK) {
+            const size_t block = (std::min)(kBlockK, K - k0);
+            for (size_t l = begin; l < end; l++) {
+                const float *a = A + (rows ? rows[l] : l) * lda + k0;
+                float *c = C + l * ldc;
+                for (size_t j = 0; j < static_cast<size_t>(N); j += kMaxDotProducts) {
+                    const size_t num_b = (std::min)(kMaxDotProducts, N - j);
+                    DotProducts(a, cols + j * K + k0, K, num_b, block, sums);
+                    for (size_t t = 0; t < num_b; t++) {
+                        c[j + t] += sums[t];
+                    }
+                }
+            }
+        }
+    });
+}
+
+void zero_rows(const MKL_INT L, const MKL_INT N, float *C, const MKL_INT ldc) {
+    for (MKL_INT l = 0; l < L; l++) {
+        std::fill_n(C + static_cast<size_t>(l) * ldc, N, 0.0f);
+    }
+}
+
+}  // namespace
+
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
 #endif
@@ -27,15 +123,10 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
+        if (beta != 1.0) {
+            zero_rows(M, N, C, ldc);
         }
+        sgemm_nn_blocked(M, N, K, A, lda, nullptr, B, ldb, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +196,10 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
+        if (beta != 1.0) {
+            zero_rows(L, N, C, ldc);
         }
+        sgemm_nn_blocked(L, N, K, A, lda, OutputList, B, ldb, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,20 +238,21 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+    const uint32_t num_columns = K1 + K2;
+
+    // the rows of X are multiplied by the same A1 and A2
+    ParallelForRows(N, num_columns, [&](size_t begin, size_t end) {
+        float sums1[kMaxDotProducts], sums2[kMaxDotProducts];
+        for (size_t i = begin; i < end; i += kMaxDotProducts) {
+            const size_t num_rows = (std::min)(kMaxDotProducts, end - i);
+            const float *x = X + i * num_columns;
+            DotProducts(A1, x, num_columns, num_rows, K1, sums1);
+            DotProducts(A2, x + K1, num_columns, num_rows, K2, sums2);
+            for (size_t j = 0; j < num_rows; j++) {
+                C[i + j] = B[i + j] + sums1[j] + sums2[j];
+            }
         }
-        C[i] = sum;
-    }
+    });
 }
 
 #ifdef __cplusplus
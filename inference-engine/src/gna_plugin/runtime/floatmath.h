@@ -6,6 +6,10 @@
 
 #include <cstdlib>
 #include <cstdio>
+#include <cstdint>
+#include <algorithm>
+
+#include <ie_parallel.hpp>
 
 #ifndef _NO_MKL_
 #include <mkl_dnn.h>
@@ -62,3 +66,38 @@ void sgemv_split(const uint32_t N,
 #ifdef __cplusplus
 }
 #endif
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief The maximal number of the dot products computed by one DotProducts() call
+ */
+constexpr size_t kMaxDotProducts = 4;
+
+/**
+ * @brief Computes sums[j] = a[0:k] . b[j * ldb : j * ldb + k] for j < num_b <= kMaxDotProducts,
+ * the loads of a are shared between the products. Uses AVX-512 or AVX2 if the CPU supports them.
+ */
+void DotProducts(const float *a, const float *b, size_t ldb, size_t num_b, size_t k, float *sums);
+
+/**
+ * @brief Calls func(begin, end) for the blocks of rows in parallel, the blocks are big enough
+ * to pay off the threading, so the small layers are computed by the calling thread
+ */
+template <typename F>
+void ParallelForRows(size_t num_rows, size_t macs_per_row, const F &func) {
+    constexpr size_t kMinMacsPerTask = 1 << 15;
+    const size_t rows_per_task = (std::max)(static_cast<size_t>(1), kMinMacsPerTask / (std::max)(static_cast<size_t>(1), macs_per_row));
+    const size_t num_tasks = (num_rows + rows_per_task - 1) / rows_per_task;
+    if (num_tasks <= 1) {
+        func(static_cast<size_t>(0), num_rows);
+        return;
+    }
+    InferenceEngine::parallel_for(num_tasks, [&](size_t task) {
+        func(task * rows_per_task, (std::min)(num_rows, (task + 1) * rows_per_task));
+    });
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
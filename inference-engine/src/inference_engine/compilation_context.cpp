@@ -0,0 +1,145 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+
+#include <ngraph/pass/manager.hpp>
+#include <transformations/serialize.hpp>
+
+#include "ie_itt.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+template <typename T>
+void hash_combine(uint64_t& seed, const T& value) {
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * @brief Stream buffer which hashes everything written to it instead of storing,
+ *        so that large weights are never copied while a network is serialized
+ */
+class HashStreamBuf final : public std::streambuf {
+    uint64_t _hash = 0;
+    uint64_t _tail = 0;
+    size_t _tailSize = 0;
+
+    void put(const char* data, std::streamsize size) {
+        while (size > 0) {
+            if (_tailSize == 0 && size >= static_cast<std::streamsize>(sizeof(uint64_t))) {
+                uint64_t word;
+                std::memcpy(&word, data, sizeof(word));
+                hash_combine(_hash, word);
+                data += sizeof(word);
+                size -= sizeof(word);
+                continue;
+            }
+            _tail = (_tail << 8) | static_cast<unsigned char>(*data++);
+            --size;
+            if (++_tailSize == sizeof(uint64_t)) {
+                hash_combine(_hash, _tail);
+                _tail = 0;
+                _tailSize = 0;
+            }
+        }
+    }
+
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize size) override {
+        put(data, size);
+        return size;
+    }
+
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            char c = traits_type::to_char_type(ch);
+            put(&c, 1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+public:
+    uint64_t getHash() const {
+        uint64_t result = _hash;
+        hash_combine(result, _tail);
+        hash_combine(result, _tailSize);
+        return result;
+    }
+};
+
+}  // namespace
+
+std::string computeNetworkHash(const CNNNetwork& network,
+                               const std::map<std::string, std::string>& compileOptions,
+                               const std::map<std::string, ngraph::OpSet>& customOpsets) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "computeNetworkHash");
+
+    auto function = network.getFunction();
+    if (!function) {
+        return {};
+    }
+
+    HashStreamBuf xmlHash, binHash;
+    {
+        std::ostream xmlStream(&xmlHash), binStream(&binHash);
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::Serialize>(
+            xmlStream, binStream, ngraph::pass::Serialize::Version::IR_V10, customOpsets);
+        // Serialize does not modify the function
+        manager.run_passes(std::const_pointer_cast<ngraph::Function>(function));
+    }
+
+    uint64_t seed = 0;
+    hash_combine(seed, xmlHash.getHash());
+    hash_combine(seed, binHash.getHash());
+
+    // inputs / outputs information can be changed by a user after the network is read
+    for (const auto& input : network.getInputsInfo()) {
+        hash_combine(seed, input.first);
+        hash_combine(seed, std::string(input.second->getPrecision().name()));
+        hash_combine(seed, static_cast<int>(input.second->getLayout()));
+
+        const auto& preProcess = input.second->getPreProcess();
+        hash_combine(seed, static_cast<int>(preProcess.getResizeAlgorithm()));
+        hash_combine(seed, static_cast<int>(preProcess.getColorFormat()));
+        hash_combine(seed, static_cast<int>(preProcess.getMeanVariant()));
+        if (preProcess.getMeanVariant() == MEAN_VALUE) {
+            for (size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+                hash_combine(seed, preProcess[c]->stdScale);
+                hash_combine(seed, preProcess[c]->meanValue);
+            }
+        } else if (preProcess.getMeanVariant() == MEAN_IMAGE) {
+            // mean images are not hashed, so such networks are compiled every time
+            return {};
+        }
+    }
+    for (const auto& output : network.getOutputsInfo()) {
+        hash_combine(seed, output.first);
+        hash_combine(seed, std::string(output.second->getPrecision().name()));
+        hash_combine(seed, static_cast<int>(output.second->getLayout()));
+    }
+
+    for (const auto& option : compileOptions) {
+        hash_combine(seed, option.first);
+        hash_combine(seed, option.second);
+    }
+
+    std::stringstream hash;
+    hash << std::hex << std::setw(16) << std::setfill('0') << seed;
+    return hash.str();
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,32 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/opsets/opset.hpp>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Computes a hash which identifies a compiled network in the compiled networks cache
+ *
+ * The hash covers the serialized network (topology and weights), inputs / outputs information including
+ * pre-processing, and the compile options (device name, plugin version and configuration).
+ *
+ * @param network A network to compute hash for
+ * @param compileOptions Device-specific options which influence network compilation
+ * @param customOpsets Opsets registered by extensions which are required to serialize the network
+ * @return A hash string or empty string if the network cannot be hashed (e.g. it is not ngraph-based)
+ */
+std::string computeNetworkHash(const CNNNetwork& network,
+                               const std::map<std::string, std::string>& compileOptions,
+                               const std::map<std::string, ngraph::OpSet>& customOpsets = {});
+
+}  // namespace details
+}  // namespace InferenceEngine
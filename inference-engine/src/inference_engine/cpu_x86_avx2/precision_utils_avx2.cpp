@@ -0,0 +1,141 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+
+#include <immintrin.h>  // AVX2, F16C
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx2 {
+
+static inline __m256 mm256_scale_bias(__m256 x, __m256 scale, __m256 bias) {
+    return _mm256_add_ps(_mm256_mul_ps(x, scale), bias);
+}
+
+// The same algorithm as the scalar f32tof16(): rounding to nearest by adding a half of f16 ULP,
+// saturation to the maximal f16 value and flushing of f16 denormals to zero.
+// The f16 values are returned in the low halves of 32 bit lanes.
+static inline __m256i mm256_cvt_f32_f16(__m256 x) {
+    const __m256i exp_mask_f32 = _mm256_set1_epi32(0x7F800000);
+    const __m256 min16      = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 half_min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 15) << 23));
+    const __m256 max16      = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    const __m256i u = _mm256_castps_si256(x);
+    const __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x8000));
+    const __m256i a = _mm256_and_si256(u, _mm256_set1_epi32(0x7FFFFFFF));
+    const __m256i e = _mm256_and_si256(a, exp_mask_f32);
+
+    const __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(e), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23)));
+    const __m256 v = _mm256_add_ps(_mm256_castsi256_ps(a), half_ulp);
+
+    // change exp bias from 127 to 15 and round to f16, then handle the values out of the normal f16 range
+    __m256i r = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v), _mm256_set1_epi32((127 - 15) << 23)), 23 - 10);
+    r = _mm256_blendv_epi8(r, _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF), _mm256_castps_si256(_mm256_cmp_ps(v, max16, _CMP_GE_OQ)));
+    r = _mm256_blendv_epi8(r, _mm256_set1_epi32(1 << 10), _mm256_castps_si256(_mm256_cmp_ps(v, min16, _CMP_LT_OQ)));
+    r = _mm256_blendv_epi8(r, _mm256_setzero_si256(), _mm256_castps_si256(_mm256_cmp_ps(v, half_min16, _CMP_LT_OQ)));
+
+    // NAN and INF
+    const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(a, 23 - 10), _mm256_set1_epi32(0x0200));
+    const __m256i nan_inf = _mm256_blendv_epi8(nan, _mm256_set1_epi32(0x7C00), _mm256_cmpeq_epi32(a, exp_mask_f32));
+    r = _mm256_blendv_epi8(r, nan_inf, _mm256_cmpeq_epi32(e, exp_mask_f32));
+
+    return _mm256_and_si256(_mm256_or_si256(r, s), _mm256_set1_epi32(0xFFFF));
+}
+
+// The same rounding as the scalar f32tobf16()
+static inline __m256i mm256_cvt_f32_bf16(__m256 x) {
+    const __m256i u = _mm256_castps_si256(x);
+    const __m256i round = _mm256_srli_epi32(_mm256_and_si256(u, _mm256_set1_epi32(0x00010000)), 1);
+    return _mm256_srli_epi32(_mm256_add_epi32(u, round), 16);
+}
+
+// Packs the low halves of 32 bit lanes of a and b
+static inline __m256i mm256_pack_u32_u16(__m256i a, __m256i b) {
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8);
+}
+
+void f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        if (scaled) {
+            x = mm256_scale_bias(x, vscale, vbias);
+        }
+        _mm256_storeu_ps(dst + i, x);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = scaled ? PrecisionUtils::f16tof32(src[i]) * scale + bias : PrecisionUtils::f16tof32(src[i]);
+    }
+}
+
+void f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m256 x0 = _mm256_loadu_ps(src + i);
+        __m256 x1 = _mm256_loadu_ps(src + i + 8);
+        if (scaled) {
+            x0 = mm256_scale_bias(x0, vscale, vbias);
+            x1 = mm256_scale_bias(x1, vscale, vbias);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            mm256_pack_u32_u16(mm256_cvt_f32_f16(x0), mm256_cvt_f32_f16(x1)));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(scaled ? src[i] * scale + bias : src[i]);
+    }
+}
+
+void bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m256i u = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        __m256 x = _mm256_castsi256_ps(_mm256_slli_epi32(u, 16));
+        if (scaled) {
+            x = mm256_scale_bias(x, vscale, vbias);
+        }
+        _mm256_storeu_ps(dst + i, x);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = scaled ? PrecisionUtils::bf16tof32(src[i]) * scale + bias : PrecisionUtils::bf16tof32(src[i]);
+    }
+}
+
+void f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m256 x0 = _mm256_loadu_ps(src + i);
+        __m256 x1 = _mm256_loadu_ps(src + i + 8);
+        if (scaled) {
+            x0 = mm256_scale_bias(x0, vscale, vbias);
+            x1 = mm256_scale_bias(x1, vscale, vbias);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            mm256_pack_u32_u16(mm256_cvt_f32_bf16(x0), mm256_cvt_f32_bf16(x1)));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tobf16(scaled ? src[i] * scale + bias : src[i]);
+    }
+}
+
+}  // namespace avx2
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+
+#include <immintrin.h>  // AVX512F
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx512 {
+
+static inline __m512 mm512_scale_bias(__m512 x, __m512 scale, __m512 bias) {
+    return _mm512_add_ps(_mm512_mul_ps(x, scale), bias);
+}
+
+// The same algorithm as the scalar f32tof16(): rounding to nearest by adding a half of f16 ULP,
+// saturation to the maximal f16 value and flushing of f16 denormals to zero
+static inline __m256i mm512_cvt_f32_f16(__m512 x) {
+    const __m512i exp_mask_f32 = _mm512_set1_epi32(0x7F800000);
+    const __m512 min16      = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 half_min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 15) << 23));
+    const __m512 max16      = _mm512_castsi512_ps(_mm512_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    const __m512i u = _mm512_castps_si512(x);
+    const __m512i s = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(0x8000));
+    const __m512i a = _mm512_and_si512(u, _mm512_set1_epi32(0x7FFFFFFF));
+    const __m512i e = _mm512_and_si512(a, exp_mask_f32);
+
+    const __m512 half_ulp = _mm512_mul_ps(_mm512_castsi512_ps(e), _mm512_castsi512_ps(_mm512_set1_epi32((127 - 11) << 23)));
+    const __m512 v = _mm512_add_ps(_mm512_castsi512_ps(a), half_ulp);
+
+    // change exp bias from 127 to 15 and round to f16, then handle the values out of the normal f16 range
+    __m512i r = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(v), _mm512_set1_epi32((127 - 15) << 23)), 23 - 10);
+    r = _mm512_mask_mov_epi32(r, _mm512_cmp_ps_mask(v, max16, _CMP_GE_OQ), _mm512_set1_epi32(((15 + 15) << 10) | 0x3FF));
+    r = _mm512_mask_mov_epi32(r, _mm512_cmp_ps_mask(v, min16, _CMP_LT_OQ), _mm512_set1_epi32(1 << 10));
+    r = _mm512_mask_mov_epi32(r, _mm512_cmp_ps_mask(v, half_min16, _CMP_LT_OQ), _mm512_setzero_si512());
+
+    // NAN and INF
+    const __m512i nan = _mm512_or_si512(_mm512_srli_epi32(a, 23 - 10), _mm512_set1_epi32(0x0200));
+    const __m512i nan_inf = _mm512_mask_mov_epi32(nan, _mm512_cmpeq_epi32_mask(a, exp_mask_f32), _mm512_set1_epi32(0x7C00));
+    r = _mm512_mask_mov_epi32(r, _mm512_cmpeq_epi32_mask(e, exp_mask_f32), nan_inf);
+
+    // truncation keeps the low 16 bits
+    return _mm512_cvtepi32_epi16(_mm512_or_si512(r, s));
+}
+
+// The same rounding as the scalar f32tobf16()
+static inline __m256i mm512_cvt_f32_bf16(__m512 x) {
+    const __m512i u = _mm512_castps_si512(x);
+    const __m512i round = _mm512_srli_epi32(_mm512_and_si512(u, _mm512_set1_epi32(0x00010000)), 1);
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(_mm512_add_epi32(u, round), 16));
+}
+
+void f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        if (scaled) {
+            x = mm512_scale_bias(x, vscale, vbias);
+        }
+        _mm512_storeu_ps(dst + i, x);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = scaled ? PrecisionUtils::f16tof32(src[i]) * scale + bias : PrecisionUtils::f16tof32(src[i]);
+    }
+}
+
+void f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = _mm512_loadu_ps(src + i);
+        if (scaled) {
+            x = mm512_scale_bias(x, vscale, vbias);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), mm512_cvt_f32_f16(x));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(scaled ? src[i] * scale + bias : src[i]);
+    }
+}
+
+void bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        const __m512i u = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        __m512 x = _mm512_castsi512_ps(_mm512_slli_epi32(u, 16));
+        if (scaled) {
+            x = mm512_scale_bias(x, vscale, vbias);
+        }
+        _mm512_storeu_ps(dst + i, x);
+    }
+    for (; i < nelem; i++) {
+        dst[i] = scaled ? PrecisionUtils::bf16tof32(src[i]) * scale + bias : PrecisionUtils::bf16tof32(src[i]);
+    }
+}
+
+void f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const bool scaled = scale != 1.f || bias != 0.f;
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = _mm512_loadu_ps(src + i);
+        if (scaled) {
+            x = mm512_scale_bias(x, vscale, vbias);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), mm512_cvt_f32_bf16(x));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tobf16(scaled ? src[i] * scale + bias : src[i]);
+    }
+}
+
+}  // namespace avx512
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
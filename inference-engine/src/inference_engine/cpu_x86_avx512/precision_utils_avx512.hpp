@@ -0,0 +1,33 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "precision_utils.h"
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx512 {
+
+//------------------------------------------------------------------------
+//
+// Precision conversions manually vectored for AVX-512F (w/o threads),
+// the results are bitwise equal to the scalar conversions if neither scale nor bias
+// is applied, otherwise they may be computed by a fused multiply-add
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias);
+
+void bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias);
+
+void f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace avx512
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,145 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Storage of compiled networks used by Core when CACHE_DIR is set
+ * @file ie_cache_manager.hpp
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <details/ie_exception.hpp>
+#include "file_utils.h"
+
+#ifndef _WIN32
+# include <sys/stat.h>
+# include <unistd.h>
+#else
+# include <direct.h>
+# include <process.h>
+#endif
+
+namespace InferenceEngine {
+
+/**
+ * @brief Interface of a storage for compiled networks addressed by a network hash
+ */
+class ICacheManager {
+public:
+    using Ptr = std::shared_ptr<ICacheManager>;
+
+    virtual ~ICacheManager() = default;
+
+    /**
+     * @brief Callback which writes a cache entry to the provided stream
+     */
+    using StreamWriter = std::function<void(std::ostream&)>;
+
+    /**
+     * @brief Callback which reads a cache entry from the provided stream
+     */
+    using StreamReader = std::function<void(std::istream&)>;
+
+    /**
+     * @brief Writes a cache entry. The entry becomes visible to readers only when the writer succeeds
+     * @param id Identifier of the entry
+     * @param writer Callback which serializes the entry
+     */
+    virtual void writeCacheEntry(const std::string& id, StreamWriter writer) = 0;
+
+    /**
+     * @brief Reads a cache entry; reader is not called if there is no entry with the given id
+     * @param id Identifier of the entry
+     * @param reader Callback which deserializes the entry
+     * @return `true` if the entry exists
+     */
+    virtual bool readCacheEntry(const std::string& id, StreamReader reader) = 0;
+
+    /**
+     * @brief Removes a cache entry, e.g. when it cannot be imported anymore
+     * @param id Identifier of the entry
+     */
+    virtual void removeCacheEntry(const std::string& id) = 0;
+};
+
+/**
+ * @brief Stores every cache entry as a separate `<id>.blob` file in a cache directory
+ */
+class FileStorageCacheManager final : public ICacheManager {
+    std::string _cacheDir;
+
+    std::string getBlobFile(const std::string& id) const {
+        return FileUtils::makePath(_cacheDir, id + ".blob");
+    }
+
+public:
+    explicit FileStorageCacheManager(const std::string& cacheDir): _cacheDir(cacheDir) {
+#ifndef _WIN32
+        int result = ::mkdir(_cacheDir.c_str(), 0755);
+#else
+        int result = ::_mkdir(_cacheDir.c_str());
+#endif
+        if (result != 0 && errno != EEXIST) {
+            THROW_IE_EXCEPTION << "Failed to create cache directory " << _cacheDir;
+        }
+    }
+
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
+        auto blobFile = getBlobFile(id);
+        // Write to a temporary file first, so that concurrent readers never see a partially written entry
+#ifndef _WIN32
+        auto pid = ::getpid();
+#else
+        auto pid = ::_getpid();
+#endif
+        auto tmpFile = blobFile + ".tmp" + std::to_string(pid) + "_" + std::to_string(reinterpret_cast<std::uintptr_t>(this));
+        {
+            std::ofstream stream(tmpFile, std::ios_base::binary | std::ofstream::out);
+            if (!stream.is_open()) {
+                return;
+            }
+            try {
+                writer(stream);
+            } catch (...) {
+                stream.close();
+                std::remove(tmpFile.c_str());
+                throw;
+            }
+        }
+        std::remove(blobFile.c_str());
+        if (std::rename(tmpFile.c_str(), blobFile.c_str()) != 0) {
+            std::remove(tmpFile.c_str());
+        }
+    }
+
+    bool readCacheEntry(const std::string& id, StreamReader reader) override {
+        auto blobFile = getBlobFile(id);
+        if (!FileUtils::fileExist(blobFile)) {
+            return false;
+        }
+        std::ifstream stream(blobFile, std::ios_base::binary);
+        if (!stream.is_open()) {
+            return false;
+        }
+        reader(stream);
+        return true;
+    }
+
+    void removeCacheEntry(const std::string& id) override {
+        auto blobFile = getBlobFile(id);
+        if (FileUtils::fileExist(blobFile)) {
+            std::remove(blobFile.c_str());
+        }
+    }
+};
+
+}  // namespace InferenceEngine
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -22,6 +25,8 @@
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "ie_cache_manager.hpp"
+#include "compilation_context.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -93,6 +98,15 @@ void allowNotImplemented(F && f) {
     } catch (const NotImplemented & ex) { }
 }
 
+bool isInSupportedList(const InferencePlugin& plugin, const std::string& listName, const std::string& key) {
+    try {
+        auto supported = plugin.GetMetric(listName, {}).as<std::vector<std::string>>();
+        return std::find(supported.begin(), supported.end(), key) != supported.end();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
 }  // namespace
 
 DeviceIDParser::DeviceIDParser(const std::string& deviceNameWithID) {
@@ -170,6 +184,107 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    struct CacheStatistics {
+        unsigned int hits = 0;
+        unsigned int misses = 0;
+        float compileTimeSaved = 0.f;  // milliseconds
+    };
+
+    // CACHE_DIR values set via SetConfig, an empty device name stands for all devices
+    std::map<std::string, std::string> cacheDirs;
+    mutable std::map<std::string, CacheStatistics> cacheStatistics;
+    mutable std::mutex cacheMutex;  // to lock parallel access to cacheDirs and cacheStatistics
+
+    /**
+     * @brief Compiles a network or imports it from the compiled networks cache if it was already compiled
+     *        with the same device and configuration
+     */
+    ExecutableNetwork LoadNetworkWithCache(InferencePlugin& plugin, const CNNNetwork& network,
+                                           const std::string& deviceName,
+                                           const std::map<std::string, std::string>& config,
+                                           const std::string& cacheDir) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetworkWithCache");
+
+        // everything which can influence compilation result is a part of the hash
+        std::map<std::string, std::string> compileOptions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end()) {
+                compileOptions = it->second.defaultConfig;
+            }
+        }
+        for (auto&& option : config) {
+            compileOptions[option.first] = option.second;
+        }
+        compileOptions.erase(CONFIG_KEY(CACHE_DIR));
+        const auto version = plugin.GetVersion();
+        compileOptions["DEVICE_NAME"] = deviceName;
+        compileOptions["PLUGIN_VERSION"] = std::string(version.buildNumber ? version.buildNumber : "") +
+            std::to_string(version.apiVersion.major) + "." + std::to_string(version.apiVersion.minor);
+
+        std::map<std::string, ngraph::OpSet> customOpsets;
+        for (const auto& extension : extensions) {
+            auto opsets = extension->getOpSets();
+            customOpsets.insert(opsets.begin(), opsets.end());
+        }
+
+        std::string hash;
+        try {
+            hash = details::computeNetworkHash(network, compileOptions, customOpsets);
+        } catch (const std::exception&) {
+            // the network cannot be serialized, e.g. it contains dynamic shapes
+        }
+        if (hash.empty()) {
+            return plugin.LoadNetwork(network, config);
+        }
+
+        auto cacheManager = std::make_shared<FileStorageCacheManager>(cacheDir);
+        ExecutableNetwork execNetwork;
+        bool imported = false;
+        try {
+            cacheManager->readCacheEntry(hash, [&](std::istream& networkModel) {
+                OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetworkWithCache::Import");
+                auto start = std::chrono::steady_clock::now();
+                float compileTime = 0.f;
+                networkModel >> compileTime;
+                networkModel.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                execNetwork = plugin.ImportNetwork(networkModel, config);
+                std::chrono::duration<float, std::milli> importTime = std::chrono::steady_clock::now() - start;
+
+                std::lock_guard<std::mutex> lock(cacheMutex);
+                auto& statistics = cacheStatistics[deviceName];
+                statistics.hits++;
+                statistics.compileTimeSaved += std::max(0.f, compileTime - importTime.count());
+                imported = true;
+            });
+        } catch (const std::exception&) {
+            // the entry is corrupted or was created by an incompatible plugin, so it is recompiled
+            cacheManager->removeCacheEntry(hash);
+        }
+        if (imported) {
+            return execNetwork;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        execNetwork = plugin.LoadNetwork(network, config);
+        std::chrono::duration<float, std::milli> compileTime = std::chrono::steady_clock::now() - start;
+
+        try {
+            OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetworkWithCache::Export");
+            cacheManager->writeCacheEntry(hash, [&](std::ostream& networkModel) {
+                networkModel << compileTime.count() << std::endl;
+                execNetwork.Export(networkModel);
+            });
+        } catch (const std::exception&) {
+            // failure to store the network must not affect LoadNetwork
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cacheStatistics[deviceName].misses++;
+        return execNetwork;
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -263,7 +378,29 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+
+        std::string cacheDir;
+        auto cacheDirIt = parsed._config.find(CONFIG_KEY(CACHE_DIR));
+        if (cacheDirIt != parsed._config.end()) {
+            cacheDir = cacheDirIt->second;
+            parsed._config.erase(cacheDirIt);
+        } else {
+            cacheDir = GetCacheDir(parsed._deviceName);
+        }
+        if (cacheDir.empty()) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+
+        // plugins can use the cache directory for own purposes, e.g. to cache compiled kernels
+        if (isInSupportedList(plugin, METRIC_KEY(SUPPORTED_CONFIG_KEYS), CONFIG_KEY(CACHE_DIR))) {
+            parsed._config[CONFIG_KEY(CACHE_DIR)] = cacheDir;
+        }
+        if (!isInSupportedList(plugin, METRIC_KEY(SUPPORTED_METRICS), METRIC_KEY(IMPORT_EXPORT_SUPPORT)) ||
+            !plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>()) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+        return LoadNetworkWithCache(plugin, network, parsed._deviceName, parsed._config, cacheDir);
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -331,12 +468,40 @@ public:
 
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+        // compiled networks cache metrics are maintained by Core
+        if (name == METRIC_KEY(NUMBER_OF_CACHE_HITS) || name == METRIC_KEY(NUMBER_OF_CACHE_MISSES) ||
+            name == METRIC_KEY(CACHE_COMPILE_TIME_SAVED)) {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            const auto& statistics = cacheStatistics[parsed._deviceName];
+            if (name == METRIC_KEY(NUMBER_OF_CACHE_HITS)) {
+                return { statistics.hits };
+            } else if (name == METRIC_KEY(NUMBER_OF_CACHE_MISSES)) {
+                return { statistics.misses };
+            } else {
+                return { statistics.compileTimeSaved };
+            }
+        }
+
         // we need to return a copy of Parameter object which is created on Core side,
         // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
         // TODO: remove this WA after *-31417 is resolved
         return copyParameterValue(GetCPPPluginByName(parsed._deviceName).GetMetric(name, parsed._config));
     }
 
+    /**
+     * @brief Returns a compiled networks cache directory for a device
+     * @param deviceName A name of device
+     * @return A directory set via SetConfig for the device or for all devices, empty if caching is disabled
+     */
+    std::string GetCacheDir(const std::string& deviceName) const {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = cacheDirs.find(deviceName);
+        if (it == cacheDirs.end()) {
+            it = cacheDirs.find({});
+        }
+        return it != cacheDirs.end() ? it->second : std::string{};
+    }
+
     /**
      * @deprecated
      * @brief Returns reference to CPP plugin wrapper by a device name
@@ -382,6 +547,13 @@ public:
                         plugin.SetConfig(desc.defaultConfig);
                     });
 
+                    const auto cacheDir = GetCacheDir(deviceName);
+                    if (!cacheDir.empty() && isInSupportedList(plugin, METRIC_KEY(SUPPORTED_CONFIG_KEYS), CONFIG_KEY(CACHE_DIR))) {
+                        allowNotImplemented([&]() {
+                            plugin.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+                        });
+                    }
+
                     allowNotImplemented([&]() {
                         for (auto&& extensionLocation : desc.listOfExtentions) {
                             plugin.AddExtension(std::make_shared<Extension>(extensionLocation));
@@ -464,7 +636,22 @@ public:
      * @param deviceName A device name to set config to
      *        If empty, config is set for all the plugins / plugin's meta-data
      */
-    void SetConfigForPlugins(const std::map<std::string, std::string>& config, const std::string& deviceName) {
+    void SetConfigForPlugins(const std::map<std::string, std::string>& configs, const std::string& deviceName) {
+        auto config = configs;
+
+        // compiled networks cache is managed by Core, the plugins which use the directory for own purposes
+        // (e.g. to cache compiled kernels) still receive it
+        std::string cacheDir;
+        bool cacheDirIsSet = false;
+        auto cacheDirIt = config.find(CONFIG_KEY(CACHE_DIR));
+        if (cacheDirIt != config.end()) {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            cacheDir = cacheDirIt->second;
+            cacheDirIsSet = true;
+            cacheDirs[deviceName] = cacheDir;
+            config.erase(cacheDirIt);
+        }
+
         std::lock_guard<std::mutex> lock(pluginsMutex);
 
         // set config for plugins in registry
@@ -485,8 +672,12 @@ public:
         // set config for already created plugins
         for (auto& plugin : plugins) {
             if (deviceName.empty() || deviceName == plugin.first) {
+                auto pluginConfig = config;
+                if (cacheDirIsSet && isInSupportedList(plugin.second, METRIC_KEY(SUPPORTED_CONFIG_KEYS), CONFIG_KEY(CACHE_DIR))) {
+                    pluginConfig[CONFIG_KEY(CACHE_DIR)] = cacheDir;
+                }
                 allowNotImplemented([&]() {
-                    plugin.second.SetConfig(config);
+                    plugin.second.SetConfig(pluginConfig);
                 });
             }
         }
@@ -741,6 +932,10 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
 
     auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+    if (name == CONFIG_KEY(CACHE_DIR)) {
+        return { _impl->GetCacheDir(parsed._deviceName) };
+    }
+
     // we need to return a copy of Parameter object which is created on Core side,
     // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
     // TODO: remove this WA after *-31417 is resolved
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -148,6 +149,37 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
         "version of the OpenVINO to generate supported IR version.";
 }
 
+template <typename PathT>
+Blob::Ptr readWeights(const std::string& binPath, const PathT& weightsPath) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "readWeights");
+    std::ifstream binStream;
+    binStream.open(weightsPath, std::ios::binary);
+    if (!binStream.is_open())
+        THROW_IE_EXCEPTION << "Weights file " << binPath << " cannot be opened!";
+
+    binStream.seekg(0, std::ios::end);
+    size_t fileSize = binStream.tellg();
+    binStream.seekg(0, std::ios::beg);
+
+    TensorDesc desc(Precision::U8, { fileSize }, C);
+
+    // Map weights instead of copying them: constants will reference the mapped pages directly
+    if (auto allocator = details::make_mmap_allocator(binPath)) {
+        auto weights = make_shared_blob<uint8_t>(desc, allocator);
+        weights->allocate();
+        if (weights->cbuffer().as<const uint8_t*>() != nullptr)
+            return weights;
+    }
+
+    Blob::Ptr weights = make_shared_blob<uint8_t>(desc);
+    weights->allocate();
+
+    binStream.read(weights->buffer(), fileSize);
+
+    binStream.close();
+    return weights;
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
@@ -200,21 +232,7 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-                weights->allocate();
-
-                binStream.read(weights->buffer(), fileSize);
-
-                binStream.close();
+                Blob::Ptr weights = readWeights(bPath, weights_path);
 
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
@@ -0,0 +1,296 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tracer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace {
+
+constexpr std::size_t maxNameLength = 63;
+// ~3 MB per recording thread, the oldest events are overwritten
+constexpr std::size_t bufferCapacity = 1 << 15;
+
+struct TraceEvent {
+    char phase;
+    const char* category;
+    char name[maxNameLength + 1];
+    uint64_t timestamp;
+    uint64_t duration;
+    uint64_t id;
+};
+
+// Seqlock of one event: odd sequence while the event is written, 2 * (index + 1) when the event number index is complete
+struct TraceSlot {
+    std::atomic<uint64_t> sequence{0};
+    TraceEvent event;
+};
+
+// Written by the owning thread only, so recording doesn't need any lock
+struct ThreadBuffer {
+    ThreadBuffer(uint64_t threadId, std::size_t capacity) : slots(capacity), tid{threadId} {}
+
+    std::vector<TraceSlot> slots;
+    // number of the events recorded since the thread start, the buffer keeps the last slots.size() ones
+    std::atomic<uint64_t> recorded{0};
+    // set when the owning thread exits, the buffer is shrunk or dropped by the tracer then
+    std::atomic<bool> exited{false};
+    uint64_t tid = 0;
+    std::string threadName;  // guarded by Tracer::mutex
+};
+
+// Marks the buffer as exited at the thread exit, the tracer itself may be destroyed already
+struct LocalBufferHolder {
+    ~LocalBufferHolder() {
+        if (buffer) {
+            buffer->exited.store(true, std::memory_order_release);
+        }
+    }
+    std::shared_ptr<ThreadBuffer> buffer;
+};
+
+thread_local std::string localThreadName;
+thread_local LocalBufferHolder localBuffer;
+
+void WriteEscaped(std::ostream& stream, const char* str) {
+    for (; *str != '\0'; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\') {
+            stream << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            stream << escaped;
+        } else {
+            stream << c;
+        }
+    }
+}
+
+struct Tracer {
+    static Tracer& instance() {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    Tracer() : start{std::chrono::steady_clock::now()} {
+        if (const char* path = std::getenv("IE_TRACE_FILE")) {
+            if (path[0] != '\0') {
+                filePath = path;
+                enabled = true;
+            }
+        }
+    }
+
+    ~Tracer() {
+        if (enabled) {
+            Flush();
+        }
+    }
+
+    uint64_t Now() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    ThreadBuffer& LocalBuffer() {
+        if (!localBuffer.buffer) {
+            auto buffer = std::make_shared<ThreadBuffer>(nextThreadId++, bufferCapacity);
+            std::lock_guard<std::mutex> lock{mutex};
+            ReleaseExitedBuffers();
+            buffer->threadName = localThreadName;
+            buffers.push_back(buffer);
+            localBuffer.buffer = std::move(buffer);
+        }
+        return *localBuffer.buffer;
+    }
+
+    void Record(char phase, const char* category, const char* name, uint64_t timestamp, uint64_t duration, uint64_t id) {
+        auto& buffer = LocalBuffer();
+        const auto index = buffer.recorded.load(std::memory_order_relaxed);
+        auto& slot = buffer.slots[index % buffer.slots.size()];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        auto& event = slot.event;
+        event.phase = phase;
+        event.category = category;
+        std::strncpy(event.name, name, maxNameLength);
+        event.name[maxNameLength] = '\0';
+        event.timestamp = timestamp;
+        event.duration = duration;
+        event.id = id;
+        slot.sequence.store(2 * (index + 1), std::memory_order_release);
+        buffer.recorded.store(index + 1, std::memory_order_release);
+    }
+
+    // Copies the event number index, returns false if it is overwritten or being written by the owning thread
+    static bool ReadEvent(const ThreadBuffer& buffer, uint64_t index, TraceEvent& event) {
+        const auto& slot = buffer.slots[index % buffer.slots.size()];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * (index + 1)) {
+            return false;
+        }
+        std::memcpy(&event, &slot.event, sizeof(event));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    // Shrinks the buffers of the exited threads to the recorded events, the oldest ones are dropped
+    // when the exited threads keep more than bufferCapacity events in total. Called under the mutex.
+    void ReleaseExitedBuffers() {
+        std::size_t exitedEvents = 0;
+        for (auto&& buffer : buffers) {
+            if (!buffer->exited.load(std::memory_order_acquire)) {
+                continue;
+            }
+            const auto recorded = buffer->recorded.load(std::memory_order_acquire);
+            const auto size = static_cast<std::size_t>(std::min<uint64_t>(recorded, buffer->slots.size()));
+            if (size != buffer->slots.size()) {
+                std::vector<TraceSlot> slots(size);
+                for (auto index = recorded - size; index < recorded; ++index) {
+                    auto& slot = slots[index % size];
+                    slot.event = buffer->slots[index % buffer->slots.size()].event;
+                    slot.sequence.store(2 * (index + 1), std::memory_order_relaxed);
+                }
+                buffer->slots = std::move(slots);
+            }
+            exitedEvents += size;
+        }
+
+        auto buffer = buffers.begin();
+        while (buffer != buffers.end()) {
+            if ((*buffer)->exited.load(std::memory_order_acquire) &&
+                ((*buffer)->slots.empty() || exitedEvents > bufferCapacity)) {
+                exitedEvents -= (*buffer)->slots.size();
+                buffer = buffers.erase(buffer);
+            } else {
+                ++buffer;
+            }
+        }
+    }
+
+    void Flush() {
+        std::lock_guard<std::mutex> lock{mutex};
+        ReleaseExitedBuffers();
+        if (filePath.empty()) {
+            return;
+        }
+        std::ofstream file(filePath);
+        if (!file.is_open()) {
+            return;
+        }
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Inference Engine\"}}";
+        for (auto&& buffer : buffers) {
+            file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"";
+            if (buffer->threadName.empty()) {
+                file << "thread " << buffer->tid;
+            } else {
+                WriteEscaped(file, buffer->threadName.c_str());
+            }
+            file << "\"}}";
+
+            const auto recorded = buffer->recorded.load(std::memory_order_acquire);
+            const auto capacity = buffer->slots.size();
+            const auto first = recorded > capacity ? recorded - capacity : 0;
+            for (auto index = first; index < recorded; ++index) {
+                TraceEvent event;
+                if (!ReadEvent(*buffer, index, event)) {
+                    continue;
+                }
+                file << ",\n{\"name\":\"";
+                WriteEscaped(file, event.name);
+                file << "\",\"cat\":\"" << event.category << "\",\"ph\":\"" << event.phase
+                     << "\",\"ts\":" << event.timestamp << ",\"pid\":1,\"tid\":" << buffer->tid;
+                if (event.phase == 'X') {
+                    file << ",\"dur\":" << event.duration;
+                    if (event.id != 0) {
+                        file << ",\"args\":{\"id\":" << event.id << "}";
+                    }
+                } else {
+                    // asynchronous events are matched by the category, the name and the id
+                    file << ",\"id\":" << event.id;
+                }
+                file << "}";
+            }
+        }
+        file << "\n]}\n";
+    }
+
+    const std::chrono::steady_clock::time_point start;
+    std::atomic<bool> enabled{false};
+    std::atomic<uint64_t> nextThreadId{1};
+    std::atomic<uint64_t> nextId{1};
+    std::mutex mutex;
+    std::string filePath;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+}  // namespace
+
+bool IsTracingEnabled() {
+    return Tracer::instance().enabled.load(std::memory_order_relaxed);
+}
+
+void EnableTracing(const std::string& filePath) {
+    auto& tracer = Tracer::instance();
+    {
+        std::lock_guard<std::mutex> lock{tracer.mutex};
+        tracer.filePath = filePath;
+    }
+    tracer.enabled = true;
+}
+
+void FlushTrace() {
+    Tracer::instance().Flush();
+}
+
+void DisableTracing() {
+    Tracer::instance().enabled = false;
+}
+
+void SetTraceThreadName(const std::string& name) {
+    localThreadName = name;
+    if (localBuffer.buffer) {
+        std::lock_guard<std::mutex> lock{Tracer::instance().mutex};
+        localBuffer.buffer->threadName = name;
+    }
+}
+
+uint64_t GetTraceTimestamp() {
+    return Tracer::instance().Now();
+}
+
+uint64_t NewTraceId() {
+    return Tracer::instance().nextId++;
+}
+
+void TraceComplete(const char* category, const char* name, uint64_t startTime, uint64_t id) {
+    auto& tracer = Tracer::instance();
+    const auto now = tracer.Now();
+    tracer.Record('X', category, name, startTime, now > startTime ? now - startTime : 0, id);
+}
+
+void TraceAsyncBegin(const char* category, const char* name, uint64_t id) {
+    auto& tracer = Tracer::instance();
+    tracer.Record('b', category, name, tracer.Now(), 0, id);
+}
+
+void TraceAsyncEnd(const char* category, const char* name, uint64_t id) {
+    auto& tracer = Tracer::instance();
+    tracer.Record('e', category, name, tracer.Now(), 0, id);
+}
+
+}  // namespace InferenceEngine
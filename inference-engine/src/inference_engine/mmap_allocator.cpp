@@ -0,0 +1,94 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+#ifndef _WIN32
+
+class MmapAllocator final : public IAllocator {
+    std::string _path;
+    void* _data = nullptr;
+    size_t _sizeInBytes = 0;
+
+public:
+    explicit MmapAllocator(const std::string& path): _path(path) {}
+
+    ~MmapAllocator() {
+        free(_data);
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}  // NOLINT
+
+    /**
+     * @brief Maps the file; the requested size must not exceed the file size
+     */
+    void* alloc(size_t size) noexcept override {
+        if (_data != nullptr) {
+            return size <= _sizeInBytes ? _data : nullptr;
+        }
+
+        int fd = ::open(_path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return nullptr;
+        }
+
+        struct stat sb = {};
+        if (::fstat(fd, &sb) == -1 || sb.st_size <= 0 || static_cast<size_t>(sb.st_size) < size) {
+            ::close(fd);
+            return nullptr;
+        }
+
+        const auto fileSize = static_cast<size_t>(sb.st_size);
+        // MAP_PRIVATE keeps pages shared via the page cache while they are only read
+        void* data = ::mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // the mapping stays valid after the descriptor is closed
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            return nullptr;
+        }
+
+        _data = data;
+        _sizeInBytes = fileSize;
+        return _data;
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr || handle != _data) {
+            return false;
+        }
+        ::munmap(_data, _sizeInBytes);
+        _data = nullptr;
+        _sizeInBytes = 0;
+        return true;
+    }
+};
+
+std::shared_ptr<IAllocator> make_mmap_allocator(const std::string& path) {
+    return std::make_shared<MmapAllocator>(path);
+}
+
+#else
+
+std::shared_ptr<IAllocator> make_mmap_allocator(const std::string&) {
+    return nullptr;
+}
+
+#endif
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,28 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Creates an allocator which maps a file into the process address space instead of reading it.
+ *
+ * The first call to alloc() maps the whole file with copy-on-write semantics, so pages are faulted in
+ * lazily and shared with other processes through the page cache until somebody writes to them.
+ * The mapping is released together with the blob which owns the handle.
+ *
+ * @param path Path to the file to map
+ * @return A new allocator or nullptr if memory mapping is not supported on the current platform
+ */
+std::shared_ptr<IAllocator> make_mmap_allocator(const std::string& path);
+
+}  // namespace details
+}  // namespace InferenceEngine
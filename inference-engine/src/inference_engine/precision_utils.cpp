@@ -5,25 +5,99 @@
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
 
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+#endif
+
 #include <stdint.h>
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
+
+// Smaller arrays are converted by the calling thread, the conversion is too cheap to pay for the threading
+constexpr size_t parallelConversionThreshold = 1 << 16;
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+template <typename DstT, typename SrcT, typename Convert>
+void convertArrays(DstT* dst, const SrcT* src, size_t nelem, const Convert& convert) {
+    if (nelem < parallelConversionThreshold) {
+        convert(dst, src, nelem);
+        return;
     }
+    parallel_nt(0, [&](int ithr, int nthr) {
+        size_t start = 0, end = 0;
+        splitter(nelem, nthr, ithr, start, end);
+        convert(dst + start, src + start, end - start);
+    });
 }
 
-void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+}  // namespace
+
+// Scale and bias are applied only if they change the values, so that the negative zeros and the signaling NANs
+// are converted exactly as by the scalar functions.
+// The AVX2 versions rely on F16C as well, it's supported by all AVX2 capable CPUs
+#if defined(HAVE_AVX512) && defined(HAVE_AVX2)
+#define DISPATCH_CONVERSION(func, ...) \
+    if (with_cpu_x86_avx512f()) { avx512::func(__VA_ARGS__); return; } \
+    if (with_cpu_x86_avx2()) { avx2::func(__VA_ARGS__); return; }
+#elif defined(HAVE_AVX512)
+#define DISPATCH_CONVERSION(func, ...) \
+    if (with_cpu_x86_avx512f()) { avx512::func(__VA_ARGS__); return; }
+#elif defined(HAVE_AVX2)
+#define DISPATCH_CONVERSION(func, ...) \
+    if (with_cpu_x86_avx2()) { avx2::func(__VA_ARGS__); return; }
+#else
+#define DISPATCH_CONVERSION(func, ...)
+#endif
+
+void f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, [=](float* dst, const ie_fp16* src, size_t nelem) {
+        const bool scaled = scale != 1.f || bias != 0.f;
+        DISPATCH_CONVERSION(f16tof32Arrays, dst, src, nelem, scale, bias)
+        for (size_t i = 0; i < nelem; i++) {
+            dst[i] = scaled ? PrecisionUtils::f16tof32(src[i]) * scale + bias : PrecisionUtils::f16tof32(src[i]);
+        }
+    });
 }
 
+void f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, [=](ie_fp16* dst, const float* src, size_t nelem) {
+        const bool scaled = scale != 1.f || bias != 0.f;
+        DISPATCH_CONVERSION(f32tof16Arrays, dst, src, nelem, scale, bias)
+        for (size_t i = 0; i < nelem; i++) {
+            dst[i] = PrecisionUtils::f32tof16(scaled ? src[i] * scale + bias : src[i]);
+        }
+    });
+}
+
+void bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, [=](float* dst, const ie_bf16* src, size_t nelem) {
+        const bool scaled = scale != 1.f || bias != 0.f;
+        DISPATCH_CONVERSION(bf16tof32Arrays, dst, src, nelem, scale, bias)
+        for (size_t i = 0; i < nelem; i++) {
+            dst[i] = scaled ? PrecisionUtils::bf16tof32(src[i]) * scale + bias : PrecisionUtils::bf16tof32(src[i]);
+        }
+    });
+}
+
+void f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, [=](ie_bf16* dst, const float* src, size_t nelem) {
+        const bool scaled = scale != 1.f || bias != 0.f;
+        DISPATCH_CONVERSION(f32tobf16Arrays, dst, src, nelem, scale, bias)
+        for (size_t i = 0; i < nelem; i++) {
+            dst[i] = PrecisionUtils::f32tobf16(scaled ? src[i] * scale + bias : src[i]);
+        }
+    });
+}
+
+#undef DISPATCH_CONVERSION
+
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
 // F16: exp_bias:15  SEEEEEMM MMMMMMMM
@@ -164,5 +238,21 @@ ie_fp16 f32tof16(float x) {
     return v.u | s;
 }
 
+float bf16tof32(ie_bf16 x) {
+    // bf16 is the upper half of f32
+    return asfloat(static_cast<uint32_t>(static_cast<uint16_t>(x)) << 16);
+}
+
+// The same rounding as round_to_nearest_even() of ngraph::bfloat16 and the CPU plugin bfloat16_t
+ie_bf16 f32tobf16(float x) {
+    union {
+        float f;
+        uint32_t u;
+    } v;
+    v.f = x;
+    v.u += (v.u & 0x00010000) >> 1;
+    return static_cast<ie_bf16>(v.u >> 16);
+}
+
 }  // namespace PrecisionUtils
 }  // namespace InferenceEngine
@@ -9,7 +9,10 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
+#include <unordered_map>
 #include <atomic>
+#include <chrono>
 #include <climits>
 #include <cassert>
 #include <utility>
@@ -20,6 +23,7 @@
 #include "threading/ie_thread_affinity.hpp"
 #include "details/ie_exception.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
+#include "ie_tracer.hpp"
 #include <openvino/itt.hpp>
 
 using namespace openvino;
@@ -59,18 +63,19 @@ struct CPUStreamsExecutor::Impl {
             _impl(impl) {
             {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
-                if (_impl->_streamIdQueue.empty()) {
+                auto itWorker = _impl->_workerIds.find(std::this_thread::get_id());
+                if (itWorker != _impl->_workerIds.end()) {
+                    // a worker thread always gets the stream of its queue, so the steal order follows its NUMA node
+                    _streamId = itWorker->second;
+                    _isWorker = true;
+                } else if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
                 } else {
                     _streamId = _impl->_streamIdQueue.front();
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                ? _impl->_usedNumaNodes.at(
-                    (_streamId % _impl->_config._streams)/
-                    ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
-                : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetStreamNumaNode(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -124,7 +129,7 @@ struct CPUStreamsExecutor::Impl {
 #endif
         }
         ~Stream() {
-            {
+            if (!_isWorker) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -138,6 +143,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl     = nullptr;
         int _streamId   = 0;
         int _numaNodeId = 0;
+        bool _isWorker = false;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -146,6 +152,27 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    // Tasks submitted to a worker thread. The owner takes tasks from the front,
+    // idle workers steal from the back, so the owner and thieves rarely meet on the same task
+    struct WorkerQueue {
+        std::mutex              _mutex;
+        std::deque<Task>        _tasks;
+        std::atomic<size_t>     _size{0};
+        std::atomic<uint64_t>   _executed{0};
+        std::atomic<uint64_t>   _stolen{0};
+        std::atomic<uint64_t>   _idleTimeUs{0};
+        // workers to steal from: the ones on the same NUMA node go first
+        std::vector<int>        _victims;
+    };
+
+    int GetStreamNumaNode(const int streamId) const {
+        return _config._streams
+            ? _usedNumaNodes.at(
+                (streamId % _config._streams)/
+                ((_config._streams + _usedNumaNodes.size() - 1)/_usedNumaNodes.size()))
+            : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
     explicit Impl(const Config& config) :
         _config{config},
         _streams([this] {
@@ -159,33 +186,106 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        for (auto workerId = 0; workerId < _config._streams; ++workerId) {
+            _workerQueues.emplace_back(new WorkerQueue);
+        }
+        // stream ids below the number of streams are reserved for the worker threads
+        _streamId = _config._streams;
+        for (auto workerId = 0; workerId < _config._streams; ++workerId) {
+            auto& victims = _workerQueues[workerId]->_victims;
+            for (bool sameNumaNode : {true, false}) {
+                for (auto i = 1; i < _config._streams; ++i) {
+                    auto victimId = (workerId + i) % _config._streams;
+                    if ((GetStreamNumaNode(victimId) == GetStreamNumaNode(workerId)) == sameNumaNode) {
+                        victims.push_back(victimId);
+                    }
+                }
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
+                {
+                    std::lock_guard<std::mutex> lock{_streamIdMutex};
+                    _workerIds.emplace(std::this_thread::get_id(), streamId);
+                }
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                SetTraceThreadName(_config._name + "_" + std::to_string(streamId));
+                auto& queue = *_workerQueues[streamId];
                 for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
+                    Task task = Pop(streamId);
                     if (task) {
                         Execute(task, *(_streams.local()));
+                        ++queue._executed;
+                        continue;
+                    }
+                    auto idleStart = std::chrono::steady_clock::now();
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        ++_sleepingWorkers;
+                        _queueCondVar.wait(lock, [&] { return _pendingTasks > 0 || (stopped = _isStopped); });
+                        --_sleepingWorkers;
                     }
+                    queue._idleTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - idleStart).count();
                 }
             });
         }
     }
 
+    Task Pop(const int workerId) {
+        Task task;
+        auto& own = *_workerQueues[workerId];
+        if (own._size > 0) {
+            std::lock_guard<std::mutex> lock(own._mutex);
+            if (!own._tasks.empty()) {
+                task = std::move(own._tasks.front());
+                own._tasks.pop_front();
+                own._size = own._tasks.size();
+            }
+        }
+        for (auto it = own._victims.begin(); !task && it != own._victims.end(); ++it) {
+            auto& victim = *_workerQueues[*it];
+            if (victim._size == 0) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(victim._mutex);
+            if (!victim._tasks.empty()) {
+                task = std::move(victim._tasks.back());
+                victim._tasks.pop_back();
+                victim._size = victim._tasks.size();
+                ++own._stolen;
+            }
+        }
+        if (task) {
+            --_pendingTasks;
+        }
+        return task;
+    }
+
     void Enqueue(Task task) {
+        if (IsTracingEnabled()) {
+            // the time spent in the queue is traced as an asynchronous event, it ends on the worker thread
+            const auto id = NewTraceId();
+            TraceAsyncBegin("executor", "queued", id);
+            task = [task, id] {
+                TraceAsyncEnd("executor", "queued", id);
+                TraceScope scope{"executor", "task", id};
+                task();
+            };
+        }
+        auto& queue = *_workerQueues[_nextWorker++ % _workerQueues.size()];
         {
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+            queue._size = queue._tasks.size();
+        }
+        // A worker increments the number of sleeping workers before checking the number of pending tasks,
+        // so either it sees the new task or the notification is sent
+        ++_pendingTasks;
+        if (_sleepingWorkers > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -220,10 +320,14 @@ struct CPUStreamsExecutor::Impl {
     std::mutex                              _streamIdMutex;
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
+    std::unordered_map<std::thread::id, int> _workerIds;
     std::vector<std::thread>                _threads;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<unsigned>                   _nextWorker{0};
+    std::atomic<int>                        _pendingTasks{0};
+    std::atomic<int>                        _sleepingWorkers{0};
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -240,6 +344,14 @@ int CPUStreamsExecutor::GetNumaNodeId() {
     return stream->_numaNodeId;
 }
 
+std::vector<CPUStreamsExecutor::Statistics> CPUStreamsExecutor::GetStatistics() const {
+    std::vector<Statistics> statistics;
+    for (auto&& queue : _impl->_workerQueues) {
+        statistics.push_back({queue->_size, queue->_executed, queue->_stolen, queue->_idleTimeUs});
+    }
+    return statistics;
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
     _impl{new Impl{config}} {
 }
@@ -4,15 +4,19 @@
 
 #include "threading/ie_thread_affinity.hpp"
 #include "ie_system_conf.h"
+#include <algorithm>
 #include <climits>
 #include <cerrno>
+#include <cstdint>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 
 #if !(defined(__APPLE__) || defined(_WIN32))
 #include <sched.h>
 #include <unistd.h>
+#include <sys/syscall.h>
 #endif
 
 namespace InferenceEngine {
@@ -94,6 +98,64 @@ bool PinCurrentThreadToSocket(int socket) {
     }
     return res;
 }
+
+namespace {
+// values from linux/mempolicy.h, so libnuma is not required
+constexpr int MPOL_PREFERRED_MODE = 1;
+constexpr unsigned MPOL_MF_MOVE_FLAG = 1u << 1;
+
+std::uintptr_t PageSize() {
+    static const auto pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+}  // namespace
+
+bool BindMemoryToNumaNode(void* ptr, std::size_t size, int numaNodeId) {
+#ifdef SYS_mbind
+    constexpr int maxNodes = sizeof(unsigned long) * CHAR_BIT;  // NOLINT
+    if (numaNodeId < 0 || numaNodeId >= maxNodes)
+        return false;
+    const auto pageSize = PageSize();
+    const auto begin = (reinterpret_cast<std::uintptr_t>(ptr) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<std::uintptr_t>(ptr) + size) / pageSize * pageSize;
+    if (begin >= end)
+        return false;
+    unsigned long nodeMask = 1ul << numaNodeId;  // NOLINT
+    // the kernel expects the number of mask bits plus one
+    return 0 == syscall(SYS_mbind, begin, end - begin, MPOL_PREFERRED_MODE, &nodeMask, maxNodes + 1, MPOL_MF_MOVE_FLAG);
+#else
+    return false;
+#endif
+}
+
+std::tuple<std::size_t, std::size_t> GetMemoryNumaLocality(const void* ptr, std::size_t size, int numaNodeId) {
+    std::size_t local = 0, remote = 0;
+#ifdef SYS_move_pages
+    static constexpr std::size_t pagesPerCall = 1024;
+    const auto pageSize = PageSize();
+    const auto begin = reinterpret_cast<std::uintptr_t>(ptr);
+    const auto end = begin + size;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    for (auto page = begin / pageSize * pageSize; page < end;) {
+        pages.clear();
+        for (; page < end && pages.size() < pagesPerCall; page += pageSize)
+            pages.push_back(reinterpret_cast<void*>(page));
+        status.assign(pages.size(), -1);
+        // without target nodes move_pages only reports the node of each page
+        if (0 != syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0))
+            break;
+        for (std::size_t i = 0; i < pages.size(); i++) {
+            if (status[i] < 0)
+                continue;
+            const auto pageBegin = reinterpret_cast<std::uintptr_t>(pages[i]);
+            const auto bytes = std::min(pageBegin + pageSize, end) - std::max(pageBegin, begin);
+            (status[i] == numaNodeId ? local : remote) += bytes;
+        }
+    }
+#endif
+    return std::make_tuple(local, remote);
+}
 #else   // no threads pinning/binding on Win/MacOS
 std::tuple<CpuSet, int> GetProcessMask() {
     return std::make_tuple(nullptr, 0);
@@ -109,5 +171,11 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
+bool BindMemoryToNumaNode(void* ptr, std::size_t size, int numaNodeId) {
+    return false;
+}
+std::tuple<std::size_t, std::size_t> GetMemoryNumaLocality(const void* ptr, std::size_t size, int numaNodeId) {
+    return std::make_tuple(0, 0);
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 }  //  namespace InferenceEngine
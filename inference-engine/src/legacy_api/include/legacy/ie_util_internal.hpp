@@ -81,4 +81,14 @@ using printer_callback =
 INFERENCE_ENGINE_API_CPP(void)
 saveGraphToDot(const InferenceEngine::CNNNetwork& network, std::ostream& out, printer_callback layer_cb = nullptr);
 
+/**
+ * @brief Serializes a network with legacy layers into IR v7 format which can be read back by the IR v7 reader
+ *
+ * @param network - network to serialize
+ * @param xml - output stream for XML representation
+ * @param bin - output stream for weights
+ */
+INFERENCE_ENGINE_API_CPP(void)
+serializeToIRv7(const InferenceEngine::CNNNetwork& network, std::ostream& xml, std::ostream& bin);
+
 }  // namespace InferenceEngine
@@ -24,6 +24,7 @@
 #include <legacy/details/ie_cnn_network_iterator.hpp>
 #include <legacy/ie_layers.h>
 #include "ie_legacy_itt.hpp"
+#include "network_serializer_v7.hpp"
 
 using std::string;
 
@@ -569,4 +570,9 @@ void saveGraphToDot(const InferenceEngine::CNNNetwork& network, std::ostream& ou
     out << "}" << std::endl;
 }
 
+void serializeToIRv7(const InferenceEngine::CNNNetwork& network, std::ostream& xml, std::ostream& bin) {
+    OV_ITT_SCOPED_TASK(itt::domains::IELegacy, "serializeToIRv7");
+    Serialization::Serialize(xml, bin, network);
+}
+
 }  // namespace InferenceEngine
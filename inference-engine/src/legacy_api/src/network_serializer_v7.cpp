@@ -461,5 +461,17 @@ void Serialize(const std::string& xmlPath, const std::string& binPath,
         }
     }
 }
+
+void Serialize(std::ostream& xmlStream, std::ostream& binStream,
+               const InferenceEngine::CNNNetwork& network) {
+    pugi::xml_document doc;
+    FillXmlDoc(network, doc, false, true);
+    doc.save(xmlStream, nullptr, pugi::format_raw);
+    if (!xmlStream.good()) {
+        THROW_IE_EXCEPTION << "Error during writing network XML";
+    }
+
+    SerializeBlobs(binStream, network);
+}
 }  //  namespace Serialization
 }  //  namespace InferenceEngine
@@ -22,5 +22,14 @@ namespace Serialization {
 void Serialize(const std::string& xmlPath, const std::string& binPath,
                const InferenceEngine::CNNNetwork& network);
 
+/**
+ * @brief Serialize network into IE IR XML and binary weights streams
+ * @param xmlStream Stream to write XML representation to
+ * @param binStream Stream to write weights to
+ * @param network   network to be serialized
+ */
+void Serialize(std::ostream& xmlStream, std::ostream& binStream,
+               const InferenceEngine::CNNNetwork& network);
+
 }  // namespace Serialization
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -79,9 +79,23 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM) {
+            if (val == PluginConfigParams::YES) interOpParallelism = true;
+            else if (val == PluginConfigParams::NO) interOpParallelism = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS) {
+            if (val == PluginConfigParams::YES) collectHwPerfCounters = true;
+            else if (val == PluginConfigParams::NO) collectHwPerfCounters = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
+        } else if (key == PluginConfigParams::KEY_TRACE_FILE) {
+            traceFile = val;
         } else if (key.compare(PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE) == 0) {
             if (val == PluginConfigParams::NO)
                 lpTransformsMode = LPTransformsMode::Off;
@@ -89,6 +103,13 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_SNIPPETS_MODE) == 0) {
+            if (val == PluginConfigParams::NO)
+                enableSnippets = false;
+            else if (val == PluginConfigParams::YES)
+                enableSnippets = true;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -112,6 +133,8 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
     }
     if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
         streamExecutorConfig._streams = 1;
+    if (collectHwPerfCounters)  // the counters cover the whole process, so another stream would be counted too
+        streamExecutorConfig._streams = 1;
 
     updateProperties();
 }
@@ -141,10 +164,21 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (interOpParallelism == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::NO });
+
+        if (collectHwPerfCounters == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::NO });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_TRACE_FILE, traceFile });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
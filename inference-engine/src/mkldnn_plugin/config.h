@@ -21,7 +21,11 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interOpParallelism = false;
+    bool collectHwPerfCounters = false;
+    bool enableSnippets = false;
     std::string dumpToDot = "";
+    std::string traceFile = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
@@ -0,0 +1,209 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_ext_emitters.hpp"
+#include "jit_snippets_emitters.hpp"
+
+#include <ie_common.h>
+#include <ngraph/opsets/opset1.hpp>
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/vector_to_scalar.hpp>
+
+#include <ngraph/pass/manager.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(MKLDNNPlugin::jit_snippets_call_args, field)
+
+#define CREATE_EMITTER(e_type) [this](const std::shared_ptr<ngraph::Node>& n) \
+    -> std::shared_ptr<ngraph::snippets::Emitter> { return std::make_shared<e_type>(h, isa, n); }
+
+namespace MKLDNNPlugin {
+
+struct CPUGenerator::jit_snippet : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    jit_snippet() : jit_generator() {}
+
+    // the code is emitted by CPUGenerator::generate directly
+    void generate() override {}
+};
+
+CPUTargetMachine::CPUTargetMachine(jit_generator* h, cpu_isa_t isa) : h(h), isa(isa) {}
+
+auto CPUTargetMachine::getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                                std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> {
+    return {
+        // snippets dialect
+        {ngraph::snippets::op::Load::type_info, CREATE_EMITTER(jit_load_emitter)},
+        {ngraph::snippets::op::BroadcastLoad::type_info, CREATE_EMITTER(jit_load_emitter)},
+        {ngraph::snippets::op::ScalarLoad::type_info, CREATE_EMITTER(jit_scalar_load_emitter)},
+        {ngraph::snippets::op::Store::type_info, CREATE_EMITTER(jit_store_emitter)},
+        {ngraph::snippets::op::ScalarStore::type_info, CREATE_EMITTER(jit_scalar_store_emitter)},
+        {ngraph::snippets::op::BroadcastMove::type_info, CREATE_EMITTER(jit_broadcast_move_emitter)},
+        {ngraph::snippets::op::Scalar::type_info, CREATE_EMITTER(jit_scalar_emitter)},
+        {ngraph::snippets::op::Nop::type_info, CREATE_EMITTER(jit_nop_emitter)},
+        {ngraph::snippets::op::PowerStatic::type_info, CREATE_EMITTER(jit_power_static_emitter)},
+
+        // binary
+        {ngraph::opset1::Add::type_info, CREATE_EMITTER(jit_add_emitter)},
+        {ngraph::opset1::Divide::type_info, CREATE_EMITTER(jit_divide_emitter)},
+        {ngraph::opset1::Equal::type_info, CREATE_EMITTER(jit_equal_emitter)},
+        {ngraph::opset1::FloorMod::type_info, CREATE_EMITTER(jit_floor_mod_emitter)},
+        {ngraph::opset1::Greater::type_info, CREATE_EMITTER(jit_greater_emitter)},
+        {ngraph::opset1::GreaterEqual::type_info, CREATE_EMITTER(jit_greater_equal_emitter)},
+        {ngraph::opset1::Less::type_info, CREATE_EMITTER(jit_less_emitter)},
+        {ngraph::opset1::LessEqual::type_info, CREATE_EMITTER(jit_less_equal_emitter)},
+        {ngraph::opset1::LogicalAnd::type_info, CREATE_EMITTER(jit_logical_and_emitter)},
+        {ngraph::opset1::LogicalOr::type_info, CREATE_EMITTER(jit_logical_or_emitter)},
+        {ngraph::opset1::LogicalXor::type_info, CREATE_EMITTER(jit_logical_xor_emitter)},
+        {ngraph::opset1::Maximum::type_info, CREATE_EMITTER(jit_maximum_emitter)},
+        {ngraph::opset1::Minimum::type_info, CREATE_EMITTER(jit_minimum_emitter)},
+        {ngraph::opset1::Mod::type_info, CREATE_EMITTER(jit_mod_emitter)},
+        {ngraph::opset1::Multiply::type_info, CREATE_EMITTER(jit_multiply_emitter)},
+        {ngraph::opset1::NotEqual::type_info, CREATE_EMITTER(jit_not_equal_emitter)},
+        {ngraph::opset1::Power::type_info, CREATE_EMITTER(jit_power_dynamic_emitter)},
+        {ngraph::opset1::PRelu::type_info, CREATE_EMITTER(jit_prelu_emitter)},
+        {ngraph::opset1::SquaredDifference::type_info, CREATE_EMITTER(jit_squared_difference_emitter)},
+        {ngraph::opset1::Subtract::type_info, CREATE_EMITTER(jit_subtract_emitter)},
+        {ngraph::op::v0::Xor::type_info, CREATE_EMITTER(jit_logical_xor_emitter)},
+
+        // unary
+        {ngraph::opset1::Abs::type_info, CREATE_EMITTER(jit_abs_emitter)},
+        {ngraph::opset1::Clamp::type_info, CREATE_EMITTER(jit_clamp_emitter)},
+        {ngraph::opset1::Elu::type_info, CREATE_EMITTER(jit_elu_emitter)},
+        {ngraph::opset1::Exp::type_info, CREATE_EMITTER(jit_exp_emitter)},
+        {ngraph::opset1::LogicalNot::type_info, CREATE_EMITTER(jit_logical_not_emitter)},
+        {ngraph::opset1::Negative::type_info, CREATE_EMITTER(jit_negative_emitter)},
+        {ngraph::opset1::Relu::type_info, CREATE_EMITTER(jit_relu_emitter)},
+        {ngraph::opset1::Sigmoid::type_info, CREATE_EMITTER(jit_sigmoid_emitter)},
+        {ngraph::opset1::Sqrt::type_info, CREATE_EMITTER(jit_sqrt_emitter)},
+        {ngraph::opset1::Tanh::type_info, CREATE_EMITTER(jit_tanh_emitter)},
+    };
+}
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : isa(isa), h(std::make_shared<jit_snippet>()) {
+    if (isa != avx2 && isa != avx512_common) {
+        THROW_IE_EXCEPTION << "Snippets code generation is supported only for avx2 and avx512_common";
+    }
+    target = std::make_shared<CPUTargetMachine>(h.get(), isa);
+    jitters = target->getJitters();
+}
+
+size_t CPUGenerator::get_vec_length() const {
+    return isa == avx512_common ? 16 : 8;
+}
+
+bool CPUGenerator::is_supported(const std::shared_ptr<ngraph::Function>& f) {
+    static const auto jitters = CPUTargetMachine(nullptr, avx2).getJitters();
+
+    for (const auto& op : f->get_ordered_ops()) {
+        if (ngraph::as_type_ptr<ngraph::opset1::Parameter>(op) || ngraph::as_type_ptr<ngraph::opset1::Result>(op))
+            continue;
+        // only scalar constants are converted to registers during canonicalization
+        if (auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(op)) {
+            if (ngraph::shape_size(constant->get_shape()) != 1)
+                return false;
+            continue;
+        }
+        if (op->get_output_size() != 1 || op->get_output_element_type(0) != ngraph::element::f32)
+            return false;
+        if (jitters.find(op->get_type_info()) == jitters.end())
+            return false;
+    }
+    return true;
+}
+
+ngraph::snippets::code CPUGenerator::generate(std::shared_ptr<ngraph::Function>& f) const {
+    const size_t num_params = f->get_parameters().size();
+    const size_t num_results = f->get_results().size();
+    if (num_params + num_results > jit_snippets_call_args::max_io_num) {
+        THROW_IE_EXCEPTION << "Snippet with " << num_params << " inputs and " << num_results << " outputs can't be scheduled";
+    }
+
+    using lowered_body = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+    auto lower = [this](const std::shared_ptr<ngraph::Function>& body) {
+        lowered_body lowered;
+        for (auto n : body->get_ordered_ops()) {
+            if (ngraph::as_type_ptr<ngraph::opset1::Parameter>(n) || ngraph::as_type_ptr<ngraph::opset1::Result>(n))
+                continue;
+            auto it = jitters.find(n->get_type_info());
+            if (it == jitters.end()) {
+                THROW_IE_EXCEPTION << "Snippets code generation doesn't support " << n->get_type_name() << " operation";
+            }
+            lowered.emplace_back(it->second(n), ngraph::snippets::getRegisters(n));
+        }
+        return lowered;
+    };
+
+    auto vector_body = lower(f);
+
+    // the remainder is processed element by element with the same register assignment
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
+    manager.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    manager.run_passes(f);
+    auto scalar_body = lower(f);
+
+    const Reg64 reg_params = abi_param1;
+    const Reg64 reg_work_amount = h->rax;
+
+    h->preamble();
+
+    for (size_t i = 0; i < num_params + num_results; i++)
+        h->mov(Reg64(static_cast<int>(8 + i)), h->ptr[reg_params + GET_OFF(io) + i * sizeof(void*)]);
+    h->mov(reg_work_amount, h->ptr[reg_params + GET_OFF(work_amount)]);
+
+    Label vector_loop_label;
+    Label vector_loop_end_label;
+    Label scalar_loop_label;
+    Label scalar_loop_end_label;
+
+    h->L(vector_loop_label);
+    {
+        h->cmp(reg_work_amount, get_vec_length());
+        h->jl(vector_loop_end_label, T_NEAR);
+
+        for (const auto& op : vector_body)
+            op.first->emit_code(op.second.first, op.second.second);
+
+        h->sub(reg_work_amount, get_vec_length());
+        h->jmp(vector_loop_label, T_NEAR);
+    }
+    h->L(vector_loop_end_label);
+
+    h->L(scalar_loop_label);
+    {
+        h->cmp(reg_work_amount, 1);
+        h->jl(scalar_loop_end_label, T_NEAR);
+
+        for (const auto& op : scalar_body)
+            op.first->emit_code(op.second.first, op.second.second);
+
+        h->sub(reg_work_amount, 1);
+        h->jmp(scalar_loop_label, T_NEAR);
+    }
+    h->L(scalar_loop_end_label);
+
+    h->postamble();
+
+    for (const auto& op : vector_body)
+        op.first->emit_data();
+    for (const auto& op : scalar_body)
+        op.first->emit_data();
+
+    if (h->create_kernel() != mkldnn::impl::status::success) {
+        THROW_IE_EXCEPTION << "Failed to create snippet kernel";
+    }
+    return h->jit_ker();
+}
+
+} // namespace MKLDNNPlugin
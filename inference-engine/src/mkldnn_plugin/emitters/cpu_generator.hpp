@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include "snippets/generator.hpp"
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Arguments of a kernel produced by CPUGenerator.
+ * io holds pointers to the snippet inputs followed by the pointers to the snippet outputs,
+ * work_amount is the number of elements to be processed along the innermost dimension.
+ */
+struct jit_snippets_call_args {
+    static constexpr size_t max_io_num = 8; // R8 - R15 are reserved by AssignRegisters for inputs and outputs
+
+    const void* io[max_io_num];
+    size_t work_amount;
+};
+
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    CPUTargetMachine(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa);
+
+    auto getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                  std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> override;
+
+private:
+    mkldnn::impl::cpu::x64::jit_generator* h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+/**
+ * Generates x86-64 code for a snippet in the canonical form.
+ * The kernel processes jit_snippets_call_args::work_amount elements along the innermost dimension
+ * with vector instructions and handles the remainder with the scalar version of the same body.
+ * Iteration over the outer dimensions is a responsibility of the caller.
+ */
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() override = default;
+
+    ngraph::snippets::code generate(std::shared_ptr<ngraph::Function>& f) const override;
+
+    size_t get_vec_length() const;
+
+    // checks that every operation of the (not yet canonicalized) snippet body has an emitter for this target
+    static bool is_supported(const std::shared_ptr<ngraph::Function>& f);
+
+private:
+    struct jit_snippet;
+
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+    std::shared_ptr<jit_snippet> h;
+    std::shared_ptr<CPUTargetMachine> target;
+};
+
+} // namespace MKLDNNPlugin
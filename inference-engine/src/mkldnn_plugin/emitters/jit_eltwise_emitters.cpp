@@ -1295,7 +1295,7 @@ jit_power_static_emitter::jit_power_static_emitter(jit_generator *host, cpu_isa_
     if (!(node->input(1).get_shape() == ngraph::Shape() || ngraph::shape_size(node->input(1).get_shape()) == 1)) {
         throw ngraph::ngraph_error("unsupported non scalar power");
     }
-    power = ngraph::as_type_ptr<ngraph::op::Constant>(parent)->get_data_ptr<float>()[0];
+    power = std::dynamic_pointer_cast<ngraph::op::Constant>(parent)->get_data_ptr<float>()[0];
     scale = 1.f;
     shift = 0.f;
     push_arg_entry_of("power", float2int(power), true);
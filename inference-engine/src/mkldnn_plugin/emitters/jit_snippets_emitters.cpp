@@ -0,0 +1,225 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <snippets/snippets_isa.hpp>
+
+#include <cstring>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+/// NOP ///
+jit_nop_emitter::jit_nop_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_nop_emitter::get_inputs_num() const { return 0; }
+
+/// SCALAR ///
+jit_scalar_emitter::jit_scalar_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    // snippets::op::Scalar doesn't declare Constant as RTTI parent, so as_type_ptr can't be used here
+    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1) {
+        THROW_IE_EXCEPTION << "Scalar emitter expects a single element constant, got " << node->get_friendly_name();
+    }
+    value = constant->cast_vector<float>()[0];
+
+    prepare_table();
+}
+
+size_t jit_scalar_emitter::get_inputs_num() const { return 0; }
+
+void jit_scalar_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                   const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                   const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_scalar_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+void jit_scalar_emitter::register_table_entries() {
+    table_entry_val_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    push_arg_entry_of("scalar", bits, true);
+}
+
+/// BROADCAST_MOVE ///
+jit_broadcast_move_emitter::jit_broadcast_move_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node,
+                                                       Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    const auto& shape = node->get_input_shape(0);
+    broadcast_innermost = shape.empty() || shape.back() == 1;
+}
+
+size_t jit_broadcast_move_emitter::get_inputs_num() const { return 1; }
+
+void jit_broadcast_move_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                           const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                           const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_broadcast_move_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+
+    if (broadcast_innermost) {
+        // the value was loaded by a scalar load, so it has to be propagated from the lowest lane
+        Xmm xmm_src = Xmm(in_vec_idxs[0]);
+        if (isa == cpu::x64::sse41) {
+            if (out_vec_idxs[0] != in_vec_idxs[0])
+                h->uni_vmovups(vmm_dst, vmm_src);
+            h->shufps(Xmm(out_vec_idxs[0]), Xmm(out_vec_idxs[0]), 0x00);
+        } else {
+            h->vbroadcastss(vmm_dst, xmm_src);
+        }
+    } else if (out_vec_idxs[0] != in_vec_idxs[0]) {
+        // broadcasting by outer dimensions is resolved by the snippet scheduler
+        h->uni_vmovups(vmm_dst, vmm_src);
+    }
+}
+
+/// MEMORY ///
+jit_memory_emitter::jit_memory_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    auto& rt = node->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end()) {
+        THROW_IE_EXCEPTION << "Effective address is not assigned for " << node->get_friendly_name();
+    }
+    ea = static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+
+    auto param = ngraph::as_type_ptr<ngraph::opset1::Parameter>(node->get_input_node_shared_ptr(0));
+    broadcast_innermost = param && (param->get_shape().empty() || param->get_shape().back() == 1);
+}
+
+/// LOAD ///
+jit_load_emitter::jit_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_load_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                 const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                 const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_load_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out_vec_idxs[0]);
+    Reg64 reg_src = Reg64(static_cast<int>(ea));
+
+    if (broadcast_innermost) {
+        h->uni_vbroadcastss(vmm_dst, h->ptr[reg_src]);
+    } else {
+        h->uni_vmovups(vmm_dst, h->ptr[reg_src]);
+        h->add(reg_src, get_vec_length());
+    }
+}
+
+/// SCALAR_LOAD ///
+jit_scalar_load_emitter::jit_scalar_load_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_scalar_load_emitter::get_inputs_num() const { return 0; }
+
+void jit_scalar_load_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                        const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                        const emitter_context *emit_context) const {
+    Xmm xmm_dst = Xmm(out_vec_idxs[0]);
+    Reg64 reg_src = Reg64(static_cast<int>(ea));
+
+    h->uni_vmovss(xmm_dst, h->ptr[reg_src]);
+    if (!broadcast_innermost)
+        h->add(reg_src, sizeof(float));
+}
+
+/// STORE ///
+jit_store_emitter::jit_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_store_emitter::get_inputs_num() const { return 1; }
+
+void jit_store_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                  const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                  const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in_vec_idxs, out_vec_idxs);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in_vec_idxs, out_vec_idxs);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void jit_store_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in_vec_idxs[0]);
+    Reg64 reg_dst = Reg64(static_cast<int>(ea));
+
+    h->uni_vmovups(h->ptr[reg_dst], vmm_src);
+    h->add(reg_dst, get_vec_length());
+}
+
+/// SCALAR_STORE ///
+jit_scalar_store_emitter::jit_scalar_store_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_memory_emitter(host, host_isa, node, exec_prc) {}
+
+size_t jit_scalar_store_emitter::get_inputs_num() const { return 1; }
+
+void jit_scalar_store_emitter::emit_impl(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
+                                         const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
+                                         const emitter_context *emit_context) const {
+    Xmm xmm_src = Xmm(in_vec_idxs[0]);
+    Reg64 reg_dst = Reg64(static_cast<int>(ea));
+
+    h->uni_vmovss(h->ptr[reg_dst], xmm_src);
+    h->add(reg_dst, sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,236 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_embedding_table_decompression.h"
+
+#include <legacy/details/ie_cnn_network_tools.h>
+#include <legacy/graph_tools.hpp>
+#include <blob_factory.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+/**
+ * Affine map y = scale * x + shift, every vector holds either one value for the whole table or one value per table row
+ */
+struct RowAffine {
+    std::vector<float> scales = {1.f};
+    std::vector<float> shifts = {0.f};
+
+    static float at(const std::vector<float>& values, size_t row) {
+        return values.size() == 1 ? values[0] : values[row];
+    }
+
+    // this = this(other(x))
+    void applyAfter(const RowAffine& other) {
+        const size_t size = std::max(std::max(scales.size(), shifts.size()),
+                                     std::max(other.scales.size(), other.shifts.size()));
+        std::vector<float> newScales(size), newShifts(size);
+        for (size_t row = 0; row < size; row++) {
+            newScales[row] = at(scales, row) * at(other.scales, row);
+            newShifts[row] = at(scales, row) * at(other.shifts, row) + at(shifts, row);
+        }
+        scales = std::move(newScales);
+        shifts = std::move(newShifts);
+    }
+};
+
+bool isTableLookup(const CNNLayerPtr& layer) {
+    if (layer->type == "EmbeddingBagOffsetsSum" || layer->type == "EmbeddingBagPackedSum" ||
+        layer->type == "EmbeddingSegmentsSum")
+        return true;
+    return layer->type == "Gather" && layer->insData.size() == 2 && layer->GetParamAsInt("axis", -1) == 0;
+}
+
+CNNLayerPtr getSingleCreator(const DataPtr& data) {
+    if (data == nullptr || getInputTo(data).size() != 1)
+        return nullptr;
+    return getCreatorLayer(data).lock();
+}
+
+/**
+ * Reads FP32 constant broadcastable to the table as a per table or per row vector, returns false for other shapes
+ */
+bool readRowConstant(const CNNLayerPtr& constLayer, const SizeVector& tableDims, std::vector<float>& values) {
+    if (constLayer == nullptr || constLayer->type != "Const" || constLayer->outData.size() != 1)
+        return false;
+    auto blobIt = constLayer->blobs.find("custom");
+    if (blobIt == constLayer->blobs.end() || blobIt->second->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    const auto& dims = constLayer->outData[0]->getTensorDesc().getDims();
+    const size_t size = blobIt->second->size();
+    if (size != 1) {
+        if (dims.size() != tableDims.size() || dims[0] != tableDims[0] || size != tableDims[0])
+            return false;
+    }
+
+    const float* data = blobIt->second->cbuffer().as<const float*>() +
+                        blobIt->second->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    values.assign(data, data + size);
+    return true;
+}
+
+/**
+ * Converts the layer of the decompression chain to the affine map of the data coming from dataInput,
+ * returns the constant input layers which become unused after the layer removal
+ */
+bool toRowAffine(const CNNLayerPtr& layer, const DataPtr& dataInput, const SizeVector& tableDims,
+                 RowAffine& affine, std::vector<CNNLayerPtr>& constInputs) {
+    if (layer->type == "Power") {
+        if (layer->insData.size() != 1 || layer->GetParamAsFloat("power", 1.f) != 1.f)
+            return false;
+        affine.scales = {layer->GetParamAsFloat("scale", 1.f)};
+        affine.shifts = {layer->GetParamAsFloat("shift", 0.f)};
+        return true;
+    }
+
+    if (layer->type == "ScaleShift") {
+        // ScaleShift broadcasts along the channels, so it is only expressible with per table values
+        for (const auto& name : {"weights", "biases"}) {
+            auto blobIt = layer->blobs.find(name);
+            if (blobIt == layer->blobs.end())
+                continue;
+            if (blobIt->second->getTensorDesc().getPrecision() != Precision::FP32 || blobIt->second->size() == 0)
+                return false;
+            const float* data = blobIt->second->cbuffer().as<const float*>();
+            if (!std::all_of(data, data + blobIt->second->size(), [&](float value) { return value == data[0]; }))
+                return false;
+            (std::string(name) == "weights" ? affine.scales : affine.shifts) = {data[0]};
+        }
+        return layer->insData.size() == 1;
+    }
+
+    if (layer->type == "Eltwise") {
+        if (layer->insData.size() != 2 || layer->CheckParamPresence("coeff"))
+            return false;
+        const size_t dataPort = layer->insData[0].lock() == dataInput ? 0 : 1;
+        auto constLayer = getCreatorLayer(layer->insData[1 - dataPort].lock()).lock();
+
+        std::vector<float> values;
+        if (!readRowConstant(constLayer, tableDims, values))
+            return false;
+
+        const std::string operation = layer->GetParamAsString("operation", "");
+        if (operation == "sum") {
+            affine.shifts = values;
+        } else if (operation == "sub" && dataPort == 0) {
+            for (auto& value : values)
+                value = -value;
+            affine.shifts = values;
+        } else if (operation == "prod") {
+            affine.scales = values;
+        } else {
+            return false;
+        }
+        constInputs.push_back(constLayer);
+        return true;
+    }
+
+    return false;
+}
+
+Blob::Ptr makeFP32Blob(const std::vector<float>& values) {
+    auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {values.size()}, Layout::C));
+    blob->allocate();
+    std::copy(values.begin(), values.end(), blob->buffer().as<float*>());
+    return blob;
+}
+
+void removeLayerWithOutputs(details::CNNNetworkImpl& network, const CNNLayerPtr& layer) {
+    for (const auto& inWeak : layer->insData) {
+        if (auto in = inWeak.lock())
+            getInputTo(in).erase(layer->name);
+    }
+    for (const auto& out : layer->outData)
+        network.removeData(out->getName());
+    network.removeLayer(layer->name);
+}
+
+}  // namespace
+
+void FuseEmbeddingTableDecompression(const std::shared_ptr<details::CNNNetworkImpl>& network) {
+    IE_SUPPRESS_DEPRECATED_START
+    auto sortedLayers = details::CNNNetSortTopologically(CNNNetwork(std::static_pointer_cast<ICNNNetwork>(network)));
+    IE_SUPPRESS_DEPRECATED_END
+
+    for (const auto& lookup : sortedLayers) {
+        if (!isTableLookup(lookup) || lookup->insData.empty())
+            continue;
+
+        const DataPtr tableData = lookup->insData[0].lock();
+        if (tableData == nullptr)
+            continue;
+        const SizeVector& tableDims = tableData->getTensorDesc().getDims();
+        if (tableDims.size() < 2)
+            continue;
+
+        // walk up from the lookup to the table constant, the chain layers are visited in the reverse order
+        RowAffine dequantization;
+        std::vector<CNNLayerPtr> chain, constInputs;
+        CNNLayerPtr tableConst;
+        DataPtr data = tableData;
+        for (CNNLayerPtr layer = getSingleCreator(data); layer != nullptr; layer = getSingleCreator(data)) {
+            if (layer->insData.empty() || layer->outData.size() != 1)
+                break;
+            const DataPtr input = layer->insData[0].lock();
+
+            if (layer->type == "Convert") {
+                auto source = getCreatorLayer(input).lock();
+                if (source != nullptr && source->type == "Const" && source->blobs.count("custom") &&
+                    (input->getPrecision() == Precision::I8 || input->getPrecision() == Precision::U8 ||
+                     input->getPrecision() == Precision::BF16) &&
+                    input->getTensorDesc().getDims() == tableDims) {
+                    chain.push_back(layer);
+                    tableConst = source;
+                }
+                break;
+            }
+
+            DataPtr dataInput = input;
+            if (layer->type == "Eltwise" && layer->insData.size() == 2) {
+                auto first = getCreatorLayer(input).lock();
+                if (first != nullptr && first->type == "Const")
+                    dataInput = layer->insData[1].lock();
+            }
+
+            RowAffine op;
+            if (!toRowAffine(layer, dataInput, tableDims, op, constInputs))
+                break;
+            dequantization.applyAfter(op);
+            chain.push_back(layer);
+            data = dataInput;
+        }
+
+        if (tableConst == nullptr)
+            continue;
+
+        // the table is only decompressed once, so the lookup has to be the single consumer of the table
+        const DataPtr compressedTable = tableConst->outData[0];
+        if (getInputTo(compressedTable).size() != 1)
+            continue;
+
+        for (const auto& layer : chain)
+            removeLayerWithOutputs(*network, layer);
+        for (const auto& constLayer : constInputs) {
+            if (getInputTo(constLayer->outData[0]).empty())
+                removeLayerWithOutputs(*network, constLayer);
+        }
+
+        lookup->insData[0] = compressedTable;
+        getInputTo(compressedTable)[lookup->name] = lookup;
+
+        lookup->blobs["dequantization_scales"] = makeFP32Blob(dequantization.scales);
+        lookup->blobs["dequantization_shifts"] = makeFP32Blob(dequantization.shifts);
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <legacy/cnn_network_impl.hpp>
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Fuses the decompression of low precision embedding tables into the lookup layers
+ * (EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum and Gather along axis 0).
+ * The chain Const (I8, U8 or BF16) -> Convert -> [Eltwise sum/sub/prod, Power, ScaleShift] is replaced by
+ * the table constant itself, the chain is stored in the lookup layer as per row (or per table) affine
+ * dequantization parameters: "dequantization_scales" and "dequantization_shifts" FP32 blobs.
+ * Has to be applied before the constant folding of the network.
+ */
+void FuseEmbeddingTableDecompression(const std::shared_ptr<InferenceEngine::details::CNNNetworkImpl>& network);
+
+}  // namespace MKLDNNPlugin
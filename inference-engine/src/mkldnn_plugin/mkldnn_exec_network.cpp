@@ -11,6 +11,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
@@ -18,6 +19,7 @@
 
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
+#include <ie_tracer.hpp>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
 #include <unordered_set>
@@ -46,6 +48,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     _numaNodesWeights(numaNodesWeights) {
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
 
+    if (!_cfg.traceFile.empty()) {
+        EnableTracing(_cfg.traceFile);
+    }
+
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNetwork(network);
 
@@ -240,6 +246,13 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    if (_cfg.collectHwPerfCounters) {
+        // counters that can't be opened are not an error, the node statistics are reported without them
+        auto counters = std::make_shared<HwPerfCounters>();
+        if (counters->isAvailable())
+            _hwPerfCounters = counters;
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -292,8 +305,15 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    // threads of the stream run on its NUMA node only when they are bound to it
+                    if (nullptr != streamsExecutor && IStreamsExecutor::ThreadBindingType::NUMA == _cfg.streamExecutorConfig._threadBindingType
+                        && getAvailableNUMANodes().size() > 1) {
+                        graphLock._graph.setNumaNodeId(numaNodeId);
+                    }
                 }
+                graphLock._graph.setHwPerfCounters(_hwPerfCounters);
                 graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
+                BindGraphMemory(graphLock._graph);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -310,6 +330,25 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+void MKLDNNExecNetwork::BindGraphMemory(const MKLDNNGraph& graph) {
+    const auto numaNodeId = graph.getNumaNodeId();
+    if (numaNodeId < 0)
+        return;
+    OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork::BindGraphMemory");
+    std::vector<std::pair<void*, size_t>> regions;
+    {
+        std::lock_guard<std::mutex> lock{_numaMemoryMutex};
+        for (auto& region : graph.GetMemoryRegions()) {
+            // weights shared between the streams of a NUMA node are bound by the first graph using them
+            if (_numaMemory.emplace(region.first, std::make_pair(region.second, numaNodeId)).second)
+                regions.push_back(region);
+        }
+    }
+    // buffers smaller than a page are left as is
+    for (auto& region : regions)
+        BindMemoryToNumaNode(region.first, region.second, numaNodeId);
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -334,6 +373,30 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return GetGraph()._graph.dump();
 }
 
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    // the legacy layers conversions above are idempotent, so the network is exported as it is used by the graphs
+    ExportedNetwork exported;
+    exported.network = _clonedNetwork;
+    exported.inputs = _networkInputs;
+    exported.outputs = _networkOutputs;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        exported.config = _cfg._config;
+    }
+    for (auto& node : GetGraph()._graph.GetNodes()) {
+        auto selected = node->getSelectedPrimitiveDescriptor();
+        if (selected == nullptr || selected->getImplementationType() == impl_desc_type::unknown) {
+            continue;
+        }
+        // the type is stored by name, the names which are not parsed back to the same type are skipped
+        auto type = node->getPrimitiveDescriptorType();
+        if (parse_impl_name(type) == selected->getImplementationType()) {
+            exported.primitives[node->getName()] = type;
+        }
+    }
+    ExportNetwork(networkModel, exported);
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -359,6 +422,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(STREAMS_EXECUTOR_STATISTICS));
+        metrics.push_back(METRIC_KEY(NUMA_MEMORY_STATISTICS));
+        metrics.push_back(METRIC_KEY(ZERO_COPY_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -373,6 +439,48 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(STREAMS_EXECUTOR_STATISTICS)) {
+        std::map<std::string, std::vector<uint64_t>> statistics;
+        auto& queueDepth = statistics["QUEUE_DEPTH"];
+        auto& executed = statistics["EXECUTED_TASKS"];
+        auto& stolen = statistics["STOLEN_TASKS"];
+        auto& idleTime = statistics["IDLE_TIME_US"];
+        if (auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor)) {
+            for (auto&& stream : streamsExecutor->GetStatistics()) {
+                queueDepth.push_back(stream.queueDepth);
+                executed.push_back(stream.executed);
+                stolen.push_back(stream.stolen);
+                idleTime.push_back(stream.idleTimeUs);
+            }
+        }
+        IE_SET_METRIC_RETURN(STREAMS_EXECUTOR_STATISTICS, statistics);
+    } else if (name == METRIC_KEY(NUMA_MEMORY_STATISTICS)) {
+        // the bound memory is not reallocated while the network exists, so the graphs are not locked
+        // and the metric doesn't wait for running inferences
+        decltype(_numaMemory) numaMemory;
+        {
+            std::lock_guard<std::mutex> lock{_numaMemoryMutex};
+            numaMemory = _numaMemory;
+        }
+        std::map<std::string, uint64_t> statistics = {{"LOCAL_BYTES", 0}, {"REMOTE_BYTES", 0}};
+        for (auto& memory : numaMemory) {
+            size_t local = 0, remote = 0;
+            std::tie(local, remote) = GetMemoryNumaLocality(memory.first, memory.second.first, memory.second.second);
+            statistics["LOCAL_BYTES"] += local;
+            statistics["REMOTE_BYTES"] += remote;
+        }
+        IE_SET_METRIC_RETURN(NUMA_MEMORY_STATISTICS, statistics);
+    } else if (name == METRIC_KEY(ZERO_COPY_STATISTICS)) {
+        std::map<std::string, std::map<std::string, uint64_t>> statistics;
+        for (auto& graph : const_cast<MKLDNNExecNetwork*>(this)->_graphs) {
+            Graph::Lock graphLock{graph};
+            for (auto& binding : graphLock._graph.getBindingStatistics()) {
+                auto& counters = statistics[binding.first];
+                counters["ZERO_COPY"] += binding.second.zeroCopy;
+                counters["COPIED"] += binding.second.copied;
+            }
+        }
+        IE_SET_METRIC_RETURN(ZERO_COPY_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -13,7 +13,9 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
 
@@ -42,6 +44,8 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void ExportImpl(std::ostream& networkModel) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
@@ -64,6 +68,11 @@ protected:
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // memory of the graphs bound to NUMA nodes: data pointer -> size and NUMA node id
+    mutable std::mutex                          _numaMemoryMutex;
+    std::map<void*, std::pair<size_t, int>>     _numaMemory;
+    // process wide counters shared by the graphs, the config forces a single stream with them
+    std::shared_ptr<HwPerfCounters>             _hwPerfCounters;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -71,6 +80,8 @@ protected:
      */
     Graph::Lock GetGraph();
 
+    void BindGraphMemory(const MKLDNNGraph& graph);
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
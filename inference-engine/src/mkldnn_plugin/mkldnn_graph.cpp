@@ -25,6 +25,8 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 #include <legacy/graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -35,6 +37,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_tracer.hpp>
 
 #include "utils/blob_dump.h"
 #include "utils/general_utils.h"
@@ -347,6 +350,8 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    CreateExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -381,6 +386,37 @@ void MKLDNNGraph::InitGraph() {
 #endif
 
     ExecuteConstantNodesOnly();
+
+    InitBindableMemory();
+}
+
+std::vector<std::pair<void*, size_t>> MKLDNNGraph::GetMemoryRegions() const {
+    std::vector<std::pair<void*, size_t>> regions;
+    std::unordered_set<void*> visited;
+
+    auto workspaceBegin = memWorkspace ? static_cast<uint8_t*>(memWorkspace->GetData()) : nullptr;
+    auto workspaceEnd = memWorkspace ? workspaceBegin + memWorkspace->GetSize() : nullptr;
+    auto addRegion = [&](const MKLDNNMemoryPtr& memory) {
+        if (!memory || !memory->GetPrimitivePtr())
+            return;
+        auto data = memory->GetData();
+        auto bytes = static_cast<uint8_t*>(data);
+        if (data == nullptr || (bytes >= workspaceBegin && bytes < workspaceEnd) || !visited.insert(data).second)
+            return;
+        regions.emplace_back(data, memory->GetSize());
+    };
+
+    if (memWorkspace)
+        regions.emplace_back(memWorkspace->GetData(), memWorkspace->GetSize());
+    for (auto& edge : graphEdges) {
+        if (edge->getStatus() == MKLDNNEdge::Status::Allocated)
+            addRegion(edge->getMemoryPtr());
+    }
+    for (auto& node : graphNodes) {
+        for (auto& memory : node->internalBlobMemory)
+            addRegion(memory);
+    }
+    return regions;
 }
 
 void MKLDNNGraph::SetOriginalLayerNames() {
@@ -615,6 +651,51 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+void MKLDNNGraph::CreateExecutionLevels() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::CreateExecutionLevels");
+
+    executionLevels.clear();
+    nodeLevels.clear();
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // the hardware counters are process wide, so the nodes are executed one by one to attribute the counts
+    if (!config.interOpParallelism || config.collectHwPerfCounters)
+        return;
+
+    // MemoryOutput -> MemoryInput dependency is not expressed by edges, keep sequential execution
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryOutput || node->getType() == MemoryInput)
+            return;
+    }
+
+    nodeLevels.assign(graphNodes.size(), 0);
+    size_t nonConstNodes = 0;
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            if (!parent->isConstant())
+                level = std::max(level, nodeLevels[parent->execIndex] + 1);
+        }
+        nodeLevels[node->execIndex] = level;
+
+        if (executionLevels.size() <= static_cast<size_t>(level))
+            executionLevels.resize(level + 1);
+        executionLevels[level].push_back(node);
+        nonConstNodes++;
+    }
+
+    // The graph is a chain, nothing to execute concurrently
+    if (executionLevels.size() == nonConstNodes) {
+        executionLevels.clear();
+        nodeLevels.clear();
+    }
+#endif
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
@@ -643,13 +724,19 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // Nodes of one execution level may run concurrently, so the level is used as a timestamp
+    // to keep their data alive during the whole level
+    auto timestamp = [&](const MKLDNNNodePtr& node) {
+        return nodeLevels.empty() ? node->execIndex : nodeLevels[node->execIndex];
+    };
+
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = timestamp(edge->getParent());
+            int e_finish = timestamp(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -755,7 +842,7 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool normalized) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -765,7 +852,11 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
-        if (ext_data_ptr != inter_data_ptr) {
+        auto& statistics = bindingStatistics[name];
+        if (ext_data_ptr == inter_data_ptr) {
+            statistics.zeroCopy++;
+        } else {
+            statistics.copied++;
             auto ext_tdesc = MKLDNNMemoryDesc {in->getTensorDesc()};
 
             auto ext_mem = MKLDNNMemory(eng);
@@ -775,7 +866,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (!normalized && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -824,7 +915,12 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         void *intr_blob_ptr = intr_blob.GetData();
 
         // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        auto& statistics = bindingStatistics[name];
+        if (ext_blob_ptr == intr_blob_ptr) {
+            statistics.zeroCopy++;
+            continue;
+        }
+        statistics.copied++;
 
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
@@ -842,25 +938,58 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
+    if (hwPerfCounters)
+        hwPerfCounters->trackThreads();
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (request != nullptr) {
-            request->ThrowIfCanceled();
+    auto execute = [&](const MKLDNNNodePtr& node, mkldnn::stream& stream) {
+        PERF(node);
+
+        if (batch > 0)
+            node->setDynamicBatchLim(batch);
+
+        ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+        if (!node->isConstant()) {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+            TraceScope trace{"node", node->getName().c_str()};
+            if (hwPerfCounters) {
+                auto before = hwPerfCounters->read();
+                node->execute(stream);
+                node->PerfCounter().addHwValues(hwPerfCounters->read() - before);
+            } else {
+                node->execute(stream);
+            }
         }
+        ENABLE_DUMP(do_after(DUMP_DIR, node));
+    };
 
-        PERF(graphNodes[i]);
+    if (executionLevels.empty()) {
+        mkldnn::stream stream(eng);
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+        for (int i = 0; i < graphNodes.size(); i++) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+            execute(graphNodes[i], stream);
+        }
+    } else {
+        for (auto& level : executionLevels) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+            if (level.size() == 1) {
+                mkldnn::stream stream(eng);
+                execute(level.front(), stream);
+            } else {
+                // mkldnn stream is not thread safe, so each concurrently executed node uses its own one
+                parallel_for(level.size(), [&](size_t i) {
+                    mkldnn::stream stream(eng);
+                    execute(level[i], stream);
+                });
+            }
         }
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
 
     if (infer_count != -1) infer_count++;
@@ -962,6 +1091,9 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        // CPU time of all the threads which worked on the node, not the wall clock time
+        if (node->PerfCounter().hasHwValues())
+            pc.cpu_uSec = (long long) (node->PerfCounter().hwAvg().taskClockNs / 1000);
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
@@ -1012,6 +1144,94 @@ void MKLDNNGraph::getOutputBlobs(InferenceEngine::BlobMap &resp) {
     }
 }
 
+bool MKLDNNGraph::IsInputMemoryReplaceable(const MKLDNNNodePtr& input) {
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto& child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+        if (split)
+            return false;
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    input->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+    }
+    return true;
+}
+
+bool MKLDNNGraph::IsOutputMemoryReplaceable(const MKLDNNNodePtr& output) {
+    void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return false;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+void MKLDNNGraph::InitBindableMemory() {
+    bindableInputs.clear();
+    bindableOutputs.clear();
+    // Dynamic batch processes a part of the tensors only, so the user buffers are always copied
+    if (config.batchLimit)
+        return;
+    // Replaceability depends on the memory sharing of the initial allocation, so it is checked before any binding
+    for (auto& input : inputNodes) {
+        // the mean image is subtracted in the input memory, which must not change the user data
+        if (input.second->getChildEdges().empty() || hasMeanImageFor(input.first) ||
+            !IsInputMemoryReplaceable(input.second))
+            continue;
+        bindableInputs.emplace(input.first, input.second->getChildEdgeAt(0)->getDesc());
+    }
+    for (auto& output : outputNodes) {
+        if (output->getParentEdges().empty() || !IsOutputMemoryReplaceable(output))
+            continue;
+        // remove out_ from node name
+        bindableOutputs.emplace(output->getName().substr(4), output->getParentEdgeAt(0)->getDesc());
+    }
+}
+
+static bool IsBindable(const std::map<std::string, TensorDesc>& bindable, const std::string& name, const TensorDesc& desc) {
+    auto it = bindable.find(name);
+    if (it == bindable.end() || it->second.getPrecision() != desc.getPrecision() || it->second.getDims() != desc.getDims())
+        return false;
+    // the layout of the user blob is assumed to be the network one if it is not specified
+    if (desc.getLayout() == Layout::ANY)
+        return true;
+    const auto& internal = it->second.getBlockingDesc();
+    const auto& external = desc.getBlockingDesc();
+    return internal.getBlockDims() == external.getBlockDims() && internal.getOrder() == external.getOrder() &&
+           internal.getStrides() == external.getStrides() && external.getOffsetPadding() == 0;
+}
+
+bool MKLDNNGraph::IsInputBindable(const std::string& name, const TensorDesc& desc) const {
+    return IsBindable(bindableInputs, name, desc);
+}
+
+bool MKLDNNGraph::IsOutputBindable(const std::string& name, const TensorDesc& desc) const {
+    return IsBindable(bindableOutputs, name, desc);
+}
+
 void MKLDNNGraph::DropNode(const MKLDNNNodePtr &node) {
     auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
         auto& edges = graph.GetEdges();
@@ -12,6 +12,7 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include "utils/hw_perf_counters.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -44,6 +45,20 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    // NUMA node the graph memory is bound to, -1 means no binding
+    void setNumaNodeId(int id) {
+        numaNodeId = id;
+    }
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+    // per node hardware counters are collected only if the counters are set
+    void setHwPerfCounters(const std::shared_ptr<HwPerfCounters>& counters) {
+        hwPerfCounters = counters;
+    }
+    // data pointers and sizes of distinct memory buffers used by the graph: workspace, edges allocated apart and weights
+    std::vector<std::pair<void*, size_t>> GetMemoryRegions() const;
+
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
@@ -56,7 +71,8 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    // normalized is true if the mean values are subtracted by the input pre-processing already
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool normalized = false);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
@@ -81,6 +97,26 @@ public:
         return inputNodes;
     }
 
+    // Checks if the memory of the input node child edges can be replaced by an external buffer,
+    // i.e. the children neither work in-place nor share the memory with their outputs
+    static bool IsInputMemoryReplaceable(const MKLDNNNodePtr& input);
+    // Checks if the memory of the output node parent edge can be replaced by an external buffer
+    static bool IsOutputMemoryReplaceable(const MKLDNNNodePtr& output);
+
+    // Checks if the user buffer with the given descriptor can be used as the input or output memory
+    // of the graph instead of copying the data, the layout conversion is done by the adjacent reorder then
+    bool IsInputBindable(const std::string& name, const InferenceEngine::TensorDesc& desc) const;
+    bool IsOutputBindable(const std::string& name, const InferenceEngine::TensorDesc& desc) const;
+
+    // Number of inferences which used the user buffers of the inputs and outputs directly and which copied them
+    struct BindingStatistics {
+        uint64_t zeroCopy = 0;
+        uint64_t copied = 0;
+    };
+    const std::map<std::string, BindingStatistics>& getBindingStatistics() const {
+        return bindingStatistics;
+    }
+
 
     mkldnn::engine getEngine() const {
         return eng;
@@ -170,6 +206,11 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executionLevels.clear();
+        nodeLevels.clear();
+        bindableInputs.clear();
+        bindableOutputs.clear();
+        bindingStatistics.clear();
         _meanImages.clear();
     }
     Status status { NotReady };
@@ -181,13 +222,30 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    int numaNodeId = -1;
+
     MKLDNNMemoryPtr memWorkspace;
 
+    // Descriptors of the input and output memory which can be replaced by the user buffers
+    std::map<std::string, InferenceEngine::TensorDesc> bindableInputs;
+    std::map<std::string, InferenceEngine::TensorDesc> bindableOutputs;
+    std::map<std::string, BindingStatistics> bindingStatistics;
+
+    // Null unless hardware performance counters are requested and available, shared by the graphs of the network
+    std::shared_ptr<HwPerfCounters> hwPerfCounters;
+
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Non constant nodes grouped by the length of the longest path from graph inputs.
+    // Nodes of one level are independent and executed concurrently when inter-op parallelism is enabled.
+    // Empty if the graph is executed sequentially.
+    std::vector<std::vector<MKLDNNNodePtr>> executionLevels;
+    // Level of each node indexed by execIndex, used as a timestamp by the memory solver
+    std::vector<int> nodeLevels;
+
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
@@ -200,11 +258,13 @@ protected:
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void CreateExecutionLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
+    void InitBindableMemory();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
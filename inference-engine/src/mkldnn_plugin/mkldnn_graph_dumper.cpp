@@ -282,6 +282,18 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    if (node->PerfCounter().hasHwValues()) {
+        auto hwValues = node->PerfCounter().hwAvg();
+        serialization_info[ExecGraphInfoSerialization::PERF_CYCLES] = std::to_string(hwValues.cycles);
+        serialization_info[ExecGraphInfoSerialization::PERF_INSTRUCTIONS] = std::to_string(hwValues.instructions);
+        serialization_info[ExecGraphInfoSerialization::PERF_CACHE_MISSES] = std::to_string(hwValues.cacheMisses);
+        serialization_info[ExecGraphInfoSerialization::PERF_CPU_TIME] = std::to_string(hwValues.taskClockNs / 1000);
+
+        auto traffic = node->getMemoryTraffic();
+        serialization_info[ExecGraphInfoSerialization::PERF_BYTES_READ] = std::to_string(traffic.first);
+        serialization_info[ExecGraphInfoSerialization::PERF_BYTES_WRITTEN] = std::to_string(traffic.second);
+    }
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
@@ -8,8 +8,6 @@
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
-#include <nodes/mkldnn_concat_node.h>
-#include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include <ie_common.h>
 #include "mkldnn_exec_network.h"
@@ -95,11 +93,56 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::isNormalizedByPreprocessing(const std::string& inputName) const {
+    if (_preProcData.find(inputName) == _preProcData.end() || !graph->hasMeanImageFor(inputName))
+        return false;
+
+    // the graph subtracts the mean values only, so the scales must be trivial to get the same result
+    const auto& info = _networkInputs.at(inputName)->getPreProcess();
+    if (info.getMeanVariant() != InferenceEngine::MEAN_VALUE)
+        return false;
+    for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+        if (info[c]->stdScale != 1.f)
+            return false;
+    }
+
+    const auto prec = _inputs.at(inputName)->getTensorDesc().getPrecision();
+    return prec == InferenceEngine::Precision::U8 || prec == InferenceEngine::Precision::FP32;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::preprocessInputs() {
+    for (auto& input : _inputs) {
+        auto preProcData = _preProcData.find(input.first);
+        if (preProcData == _preProcData.end())
+            continue;
+
+        const auto& info = _networkInputs[input.first]->getPreProcess();
+        if (!isNormalizedByPreprocessing(input.first)) {
+            preProcData->second->execute(input.second, info, false, m_curBatch);
+            continue;
+        }
+
+        // resize, color conversion, mean subtraction and conversion to FP32 are done in one pass
+        // instead of converting and normalizing the pre-processed blob on push
+        auto& normalized = normalizedInputs[input.first];
+        if (!normalized) {
+            const auto& desc = input.second->getTensorDesc();
+            normalized = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, desc.getDims(), desc.getLayout()));
+            normalized->allocate();
+        }
+        preProcData->second->execute(normalized, info, false, m_curBatch, true);
+    }
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             THROW_IE_EXCEPTION << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
+        if (isNormalizedByPreprocessing(input.first)) {
+            graph->PushInputData(input.first, normalizedInputs[input.first], true);
+            continue;
+        }
         auto inPrec = input.second->getTensorDesc().getPrecision();
 
         switch (inPrec) {
@@ -187,7 +230,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
+    preprocessInputs();
 
     changeDefaultPtr();
 
@@ -244,7 +287,6 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
         }
 
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
             InferenceEngine::Layout l = _networkInputs[name]->getLayout();
             InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
@@ -255,8 +297,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (graph->IsInputBindable(name, desc)) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -283,7 +324,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         _outputs[name] = make_blob_with_precision(desc);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        if (graph->IsOutputBindable(name, desc)) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -349,8 +390,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+            if (graph->IsInputBindable(name, data->getTensorDesc())) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -380,8 +420,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (graph->IsOutputBindable(name, data->getTensorDesc())) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -400,30 +439,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (input != graph->inputNodes.end()) {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
+            // Only the inputs which children neither work in-place nor share the memory are bound, see IsInputBindable
+            for (size_t i = 0; i < input->second->getChildEdges().size(); i++) {
                 changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
             continue;
@@ -439,27 +456,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (output) {
             if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
+            changeEdgePtr(output->getParentEdgeAt(0), it.second);
             continue;
         }
         THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
@@ -48,6 +48,8 @@ public:
     void ThrowIfCanceled() const;
 
 private:
+    void preprocessInputs();
+    bool isNormalizedByPreprocessing(const std::string& inputName) const;
     void PushInputData();
     void PushStates();
     void PullStates();
@@ -58,6 +60,7 @@ private:
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    std::map<std::string, InferenceEngine::Blob::Ptr> normalizedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
@@ -12,6 +12,7 @@
 #include <limits>
 #include <cstdint>
 #include <unordered_map>
+#include <set>
 
 #include <nodes/mkldnn_batchnorm_node.h>
 #include <nodes/mkldnn_concat_node.h>
@@ -137,6 +138,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "Subgraph", Subgraph},
 };
 
 Type TypeFromName(const std::string type) {
@@ -372,6 +374,30 @@ void MKLDNNNode::resolveNotAllocatedEdges() {
     }
 }
 
+std::pair<size_t, size_t> MKLDNNNode::getMemoryTraffic() {
+    // several edges may share the memory of one port, every buffer is counted once
+    auto sumSizes = [](const std::vector<MKLDNNEdgeWeakPtr>& edges) {
+        std::set<const void*> buffers;
+        size_t bytes = 0;
+        for (const auto& edgeWeak : edges) {
+            auto edge = edgeWeak.lock();
+            if (!edge)
+                continue;
+            const auto& memory = edge->getMemoryPtr();
+            if (memory && buffers.insert(memory->GetData()).second)
+                bytes += memory->GetSize();
+        }
+        return bytes;
+    };
+
+    size_t bytesRead = sumSizes(parentEdges);
+    for (const auto& memory : internalBlobMemory) {
+        if (memory)
+            bytesRead += memory->GetSize();
+    }
+    return {bytesRead, sumSizes(childEdges)};
+}
+
 std::string MKLDNNNode::getPrimitiveDescriptorType() {
     auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
 
@@ -740,6 +766,34 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     for (auto &it : internalBlobDesc)
         intDescs.push_back(it(itpd, 0));
 
+    // Internal blobs are built only from the blobs of the layers this node consists of.
+    // Graphs of all the streams are created from clones of the same network which share these blobs,
+    // so blob addresses identify the weights content without hashing the data
+    std::string weightsSourceKey;
+    if (weightCache != nullptr) {
+        auto appendLayerBlobs = [&weightsSourceKey](const InferenceEngine::CNNLayerPtr& layer) {
+            if (!layer)
+                return;
+            auto appendBlob = [&weightsSourceKey](const InferenceEngine::Blob::Ptr& blob) {
+                if (blob) {
+                    auto data = reinterpret_cast<uintptr_t>(blob->cbuffer().as<const void*>());
+                    weightsSourceKey += "_" + std::to_string(data);
+                }
+            };
+            for (const auto& blob : layer->blobs)
+                appendBlob(blob.second);
+            if (auto wLayer = dynamic_cast<const InferenceEngine::WeightableLayer*>(layer.get())) {
+                appendBlob(wLayer->_weights);
+                appendBlob(wLayer->_biases);
+            }
+        };
+        appendLayerBlobs(getCnnLayer());
+        for (const auto& merged : mergedWith)
+            appendLayerBlobs(merged->getCnnLayer());
+        for (const auto& fused : fusedWith)
+            appendLayerBlobs(fused->getCnnLayer());
+    }
+
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
@@ -759,14 +813,11 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+            const std::string key = name + "_" + std::to_string(i)
+                                    + "_" + std::to_string(internalBlob->byteSize())
+                                    + weightsSourceKey;
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = *weightCache->findOrCreate(key, create);
         } else {
             ptr = create();
         }
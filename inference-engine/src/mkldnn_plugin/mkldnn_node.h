@@ -10,6 +10,7 @@
 #include <string>
 #include <cassert>
 #include <algorithm>
+#include <utility>
 #include <caseless.hpp>
 #include <ie_common.h>
 #include "mkldnn_dims.h"
@@ -85,7 +86,8 @@ enum Type {
     ReduceOr,
     ReduceProd,
     ReduceSum,
-    ReduceSumSquare
+    ReduceSumSquare,
+    Subgraph
 };
 
 Type TypeFromName(const std::string type);
@@ -200,6 +202,8 @@ static std::string NameFromType(Type type) {
             return "ReduceSum";
         case ReduceSumSquare:
             return "ReduceSumSquare";
+        case Subgraph:
+            return "Subgraph";
         default:
             return "Unknown";
     }
@@ -399,6 +403,12 @@ public:
 
     std::string getPrimitiveDescriptorType();
 
+    /**
+     * @brief Returns the estimated memory traffic of one execution: bytes of the inputs and the weights
+     * which are read and bytes of the outputs which are written. Actual traffic depends on the caches.
+     */
+    std::pair<size_t, size_t> getMemoryTraffic();
+
     PerfCount &PerfCounter() { return perfCounter; }
 
     virtual void setDynamicBatchLim(int lim);
@@ -7,6 +7,8 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
+#include "mkldnn_embedding_table_decompression.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
@@ -35,6 +37,7 @@
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include <transformations/common_optimizations/depth_to_space_fusion.hpp>
+#include <transformations/common_optimizations/disable_convert_constant_folding_on_embedding_tables.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_space_to_depth.hpp>
 #include <transformations/op_conversions/convert_gelu.hpp>
@@ -70,6 +73,7 @@
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/graph_util.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -84,6 +88,10 @@
 
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_quantize_node.h"
+#include "emitters/cpu_generator.hpp"
+
+#include <snippets/op/subgraph.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -120,6 +128,9 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8 });
     }
+    // low precision embedding tables are dequantized by the lookup kernels, see FuseEmbeddingTableDecompression
+    manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnEmbeddingTables>(
+        std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::bf16 });
 
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
     manager.register_pass<ngraph::pass::ConvertPriorBox>();
@@ -275,6 +286,48 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         transformer.transform(nGraphFunc);
     }
 
+    if (conf.enableSnippets && with_cpu_x86_avx2()) {
+        OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "Snippets");
+
+        ngraph::pass::Manager snippetsManager;
+        snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+        // elementwise operations which can be fused into the preceding node as post ops are left to the graph optimizer
+        snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph, ngraph::snippets::pass::AttachToSubgraph>(
+            [](const_node_ptr &node) -> bool {
+                for (const auto& input : node->input_values()) {
+                    const auto parent = input.get_node_shared_ptr();
+                    if (ngraph::is_type<ngraph::opset1::Convolution>(parent) ||
+                        ngraph::is_type<ngraph::opset1::GroupConvolution>(parent) ||
+                        ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(parent) ||
+                        ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(parent) ||
+                        ngraph::is_type<ngraph::opset1::MatMul>(parent))
+                        return true;
+                }
+                return false;
+            });
+        snippetsManager.run_passes(nGraphFunc);
+
+        // subgraphs which can't be compiled for CPU are expanded back into the original operations
+        for (const auto& node : nGraphFunc->get_ordered_ops()) {
+            auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(node);
+            if (!subgraph)
+                continue;
+
+            bool isSupported = CPUGenerator::is_supported(subgraph->get_body()) &&
+                               subgraph->get_input_size() + subgraph->get_output_size() <= jit_snippets_call_args::max_io_num;
+            for (size_t i = 1; i < subgraph->get_output_size() && isSupported; i++)
+                isSupported = subgraph->get_output_shape(i) == subgraph->get_output_shape(0);
+            if (isSupported)
+                continue;
+
+            auto body = ngraph::clone_function(*subgraph->get_body());
+            for (size_t i = 0; i < body->get_parameters().size(); i++)
+                body->get_parameters()[i]->output(0).replace(subgraph->input_value(i));
+            for (size_t i = 0; i < body->get_results().size(); i++)
+                subgraph->output(i).replace(body->get_results()[i]->input_value(0));
+        }
+    }
+
     bool has_fake_quantize = ::ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
 
     ngraph::pass::Manager legacyManager;
@@ -374,6 +427,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     if (implNetwork) {
         OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
         // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        FuseEmbeddingTableDecompression(implNetwork);
         ConstTransformer transformator(implNetwork.get());
         transformator.fullTrim();
         if (!is_transformed) {
@@ -391,6 +445,28 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    // Exported network is already transformed, so ngraph, LPT and legacy transformations are skipped
+    auto exported = MKLDNNPlugin::ImportNetwork(networkModel, GetCore());
+
+    Config conf = engConfig;
+    conf.readProperties(exported.config);
+    conf.readProperties(config);
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(exported.network.getBatchSize());
+    }
+
+    auto impl = std::make_shared<MKLDNNExecNetwork>(exported.network, conf, extensionManager, weightsSharing);
+    impl->setNetworkInputs(exported.inputs);
+    impl->setNetworkOutputs(exported.outputs);
+    impl->SetPointerToPlugin(shared_from_this());
+    return make_executable_network(impl);
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
@@ -431,6 +507,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -477,6 +554,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -0,0 +1,292 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pugixml.hpp>
+#include <caseless.hpp>
+#include <xml_parse_utils.h>
+#include <cpp_interfaces/exception2status.hpp>
+#include <file_utils.h>
+#include <ie_system_conf.h>
+#include <legacy/ie_util_internal.hpp>
+#include <legacy/details/ie_cnn_network_iterator.hpp>
+#include "mkldnn_itt.h"
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace {
+
+void writeTensorDesc(pugi::xml_node& node, const TensorDesc& desc) {
+    node.append_attribute("precision").set_value(desc.getPrecision().name());
+    node.append_attribute("layout").set_value(static_cast<int>(desc.getLayout()));
+    auto dimsNode = node.append_child("dims");
+    for (auto dim : desc.getDims()) {
+        dimsNode.append_child("dim").text().set(static_cast<unsigned long long>(dim));
+    }
+}
+
+TensorDesc readTensorDesc(const pugi::xml_node& node) {
+    auto precision = Precision::FromStr(XMLParseUtils::GetStrAttr(node, "precision"));
+    auto layout = static_cast<Layout>(XMLParseUtils::GetIntAttr(node, "layout"));
+    SizeVector dims;
+    FOREACH_CHILD(dimNode, node.child("dims"), "dim") {
+        dims.push_back(static_cast<size_t>(dimNode.text().as_ullong()));
+    }
+    return TensorDesc(precision, dims, layout);
+}
+
+void writeInputs(pugi::xml_node& parent, const InputsDataMap& inputs) {
+    for (auto&& input : inputs) {
+        auto inputNode = parent.append_child("input");
+        inputNode.append_attribute("name").set_value(input.first.c_str());
+        writeTensorDesc(inputNode, input.second->getTensorDesc());
+
+        const auto& preProcess = input.second->getPreProcess();
+        auto preProcessNode = inputNode.append_child("preprocess");
+        preProcessNode.append_attribute("resize").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        preProcessNode.append_attribute("color").set_value(static_cast<int>(preProcess.getColorFormat()));
+        preProcessNode.append_attribute("mean").set_value(static_cast<int>(preProcess.getMeanVariant()));
+        if (preProcess.getMeanVariant() == MEAN_IMAGE) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of networks with mean image is not supported";
+        }
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            auto channelNode = preProcessNode.append_child("channel");
+            channelNode.append_attribute("mean").set_value(preProcess[c]->meanValue);
+            channelNode.append_attribute("scale").set_value(preProcess[c]->stdScale);
+        }
+    }
+}
+
+void readPreProcess(const pugi::xml_node& node, PreProcessInfo& preProcess) {
+    auto channels = node.select_nodes("channel");
+    if (!channels.empty()) {
+        preProcess.init(channels.size());
+        size_t c = 0;
+        for (auto&& channel : channels) {
+            preProcess[c]->meanValue = XMLParseUtils::GetFloatAttr(channel.node(), "mean");
+            preProcess[c]->stdScale = XMLParseUtils::GetFloatAttr(channel.node(), "scale");
+            c++;
+        }
+    }
+    preProcess.setVariant(static_cast<MeanVariant>(XMLParseUtils::GetIntAttr(node, "mean")));
+    preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(XMLParseUtils::GetIntAttr(node, "resize")));
+    preProcess.setColorFormat(static_cast<ColorFormat>(XMLParseUtils::GetIntAttr(node, "color")));
+}
+
+void writeOutputs(pugi::xml_node& parent, const OutputsDataMap& outputs) {
+    for (auto&& output : outputs) {
+        auto outputNode = parent.append_child("output");
+        outputNode.append_attribute("name").set_value(output.first.c_str());
+        writeTensorDesc(outputNode, output.second->getTensorDesc());
+    }
+}
+
+void writeBuffer(std::ostream& stream, const std::string& buffer) {
+    auto dataSize = static_cast<std::uint64_t>(buffer.size());
+    stream.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    stream.write(buffer.c_str(), dataSize);
+}
+
+std::uint64_t readBufferSize(std::istream& stream) {
+    std::uint64_t dataSize = 0;
+    stream.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Failed to read CPU plugin exported network: unexpected end of stream";
+    }
+    return dataSize;
+}
+
+// IR v7 serializer does not support the layers with body networks
+void checkSerializable(const CNNNetwork& network) {
+    for (details::CNNNetworkIterator it(network); it != details::CNNNetworkIterator(); it++) {
+        const auto& type = (*it)->type;
+        if (details::CaselessEq<std::string>()(type, "TensorIterator") || details::CaselessEq<std::string>()(type, "Loop")) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of networks with " << type << " layers is not supported";
+        }
+    }
+}
+
+// the features the JIT kernels are generated for, the selected implementations are reused on the same features only
+std::string getCpuIsa() {
+    const std::vector<std::pair<const char*, bool>> features = {
+        {"sse42", with_cpu_x86_sse42()},
+        {"avx", with_cpu_x86_avx()},
+        {"avx2", with_cpu_x86_avx2()},
+        {"avx512f", with_cpu_x86_avx512f()},
+        {"avx512_core", with_cpu_x86_avx512_core()},
+        {"bf16", with_cpu_x86_bfloat16()},
+    };
+    std::string isa;
+    for (auto&& feature : features) {
+        if (feature.second) {
+            isa += isa.empty() ? feature.first : std::string(" ") + feature.first;
+        }
+    }
+    return isa;
+}
+
+// the graph nodes created for the layers keep their names, the fused and the inserted nodes are skipped
+void setPrimitivesPriorities(CNNNetwork& network, const std::map<std::string, std::string>& primitives) {
+    for (details::CNNNetworkIterator it(network); it != details::CNNNetworkIterator(); it++) {
+        auto& layer = *it;
+        auto primitive = primitives.find(layer->name);
+        if (primitive != primitives.end() && layer->params.find("PrimitivesPriority") == layer->params.end()) {
+            layer->params["PrimitivesPriority"] = "cpu:" + primitive->second;
+        }
+    }
+}
+
+// otherwise the missing reader is reported as the removed support of IR v7
+void checkIRv7ReaderExists() {
+    auto libraryName = FileUtils::toFilePath(std::string("inference_engine_ir_v7_reader") + std::string(IE_BUILD_POSTFIX));
+    if (!FileUtils::fileExist(FileUtils::makePluginLibraryName(getInferenceEngineLibraryPath(), libraryName))) {
+        THROW_IE_EXCEPTION << "Failed to read CPU plugin exported network: the network is stored in IR v7 format, "
+            << "please, make sure that Inference Engine IR v7 reader library "
+            << FileUtils::fromFilePath(FileUtils::makePluginLibraryName({}, libraryName)) << " is in "
+            << getIELibraryPath();
+    }
+}
+
+}  // namespace
+
+void ExportNetwork(std::ostream& stream, const ExportedNetwork& exported) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "ExportNetwork");
+
+    // fail before anything is written to the stream
+    checkSerializable(exported.network);
+
+    pugi::xml_document doc;
+    auto root = doc.append_child("cpu");
+    root.append_attribute("name").set_value(exported.network.getName().c_str());
+    root.append_attribute("isa").set_value(getCpuIsa().c_str());
+
+    auto inputsNode = root.append_child("inputs");
+    writeInputs(inputsNode, exported.inputs);
+    auto outputsNode = root.append_child("outputs");
+    writeOutputs(outputsNode, exported.outputs);
+
+    // IR v7 does not keep inputs / outputs information of the transformed network
+    auto networkInputsNode = root.append_child("network_inputs");
+    writeInputs(networkInputsNode, exported.network.getInputsInfo());
+    auto networkOutputsNode = root.append_child("network_outputs");
+    writeOutputs(networkOutputsNode, exported.network.getOutputsInfo());
+
+    auto configsNode = root.append_child("configs");
+    for (auto&& config : exported.config) {
+        auto configNode = configsNode.append_child("config");
+        configNode.append_attribute("key").set_value(config.first.c_str());
+        configNode.append_attribute("value").set_value(config.second.c_str());
+    }
+
+    auto primitivesNode = root.append_child("primitives");
+    for (auto&& primitive : exported.primitives) {
+        auto primitiveNode = primitivesNode.append_child("primitive");
+        primitiveNode.append_attribute("name").set_value(primitive.first.c_str());
+        primitiveNode.append_attribute("type").set_value(primitive.second.c_str());
+    }
+
+    doc.save(stream, nullptr, pugi::format_raw);
+    stream << std::endl;
+
+    std::stringstream xmlStream, binStream;
+    serializeToIRv7(exported.network, xmlStream, binStream);
+    writeBuffer(stream, xmlStream.str());
+    writeBuffer(stream, binStream.str());
+}
+
+ExportedNetwork ImportNetwork(std::istream& stream, const ICore* core) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "ImportNetwork");
+
+    if (core == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+    checkIRv7ReaderExists();
+
+    std::string xmlString;
+    std::getline(stream, xmlString);
+
+    pugi::xml_document doc;
+    auto result = doc.load_string(xmlString.c_str());
+    if (!result) {
+        THROW_IE_EXCEPTION << "Failed to read CPU plugin exported network: " << result.description();
+    }
+    auto root = doc.document_element();
+
+    ExportedNetwork exported;
+
+    std::string irXml(readBufferSize(stream), '\0');
+    stream.read(&irXml[0], irXml.size());
+
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, {readBufferSize(stream)}, C});
+    weights->allocate();
+    stream.read(weights->buffer(), weights->size());
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Failed to read CPU plugin exported network: unexpected end of stream";
+    }
+
+    exported.network = core->ReadNetwork(irXml, weights);
+
+    // on other CPUs the stored implementations may be unsupported or not the fastest ones, so they are selected again
+    if (XMLParseUtils::GetStrAttr(root, "isa", "") == getCpuIsa()) {
+        std::map<std::string, std::string> primitives;
+        FOREACH_CHILD(primitiveNode, root.child("primitives"), "primitive") {
+            primitives[XMLParseUtils::GetStrAttr(primitiveNode, "name")] = XMLParseUtils::GetStrAttr(primitiveNode, "type");
+        }
+        setPrimitivesPriorities(exported.network, primitives);
+    }
+
+    auto networkInputs = exported.network.getInputsInfo();
+    FOREACH_CHILD(inputNode, root.child("network_inputs"), "input") {
+        auto name = XMLParseUtils::GetStrAttr(inputNode, "name");
+        auto it = networkInputs.find(name);
+        if (it == networkInputs.end()) {
+            THROW_IE_EXCEPTION << "Failed to read CPU plugin exported network: unknown input " << name;
+        }
+        auto desc = readTensorDesc(inputNode);
+        it->second->setPrecision(desc.getPrecision());
+        it->second->setLayout(desc.getLayout());
+        readPreProcess(inputNode.child("preprocess"), it->second->getPreProcess());
+    }
+    auto networkOutputs = exported.network.getOutputsInfo();
+    FOREACH_CHILD(outputNode, root.child("network_outputs"), "output") {
+        auto name = XMLParseUtils::GetStrAttr(outputNode, "name");
+        auto it = networkOutputs.find(name);
+        if (it == networkOutputs.end()) {
+            THROW_IE_EXCEPTION << "Failed to read CPU plugin exported network: unknown output " << name;
+        }
+        auto desc = readTensorDesc(outputNode);
+        it->second->setPrecision(desc.getPrecision());
+        it->second->setLayout(desc.getLayout());
+    }
+
+    FOREACH_CHILD(inputNode, root.child("inputs"), "input") {
+        auto name = XMLParseUtils::GetStrAttr(inputNode, "name");
+        auto info = std::make_shared<InputInfo>();
+        info->setInputData(std::make_shared<Data>(name, readTensorDesc(inputNode)));
+        readPreProcess(inputNode.child("preprocess"), info->getPreProcess());
+        exported.inputs[name] = info;
+    }
+    FOREACH_CHILD(outputNode, root.child("outputs"), "output") {
+        auto name = XMLParseUtils::GetStrAttr(outputNode, "name");
+        exported.outputs[name] = std::make_shared<Data>(name, readTensorDesc(outputNode));
+    }
+
+    FOREACH_CHILD(configNode, root.child("configs"), "config") {
+        exported.config[XMLParseUtils::GetStrAttr(configNode, "key")] = XMLParseUtils::GetStrAttr(configNode, "value");
+    }
+
+    return exported;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,47 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_icore.hpp>
+#include <cpp/ie_cnn_network.h>
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Content of an executable network exported by the CPU plugin
+ */
+struct ExportedNetwork {
+    InferenceEngine::CNNNetwork network;             //!< network after all plugin transformations
+    InferenceEngine::InputsDataMap inputs;           //!< user visible inputs of the executable network
+    InferenceEngine::OutputsDataMap outputs;         //!< user visible outputs of the executable network
+    std::map<std::string, std::string> config;       //!< plugin configuration the network was compiled with
+    std::map<std::string, std::string> primitives;   //!< implementation types selected for the graph nodes, by node name
+};
+
+/**
+ * @brief Writes an executable network to a stream.
+ * The transformed network is stored in IR v7 format, so the ngraph and low precision transformations
+ * are not executed again on import. The MKLDNN graph itself is not stored: graph optimizations and weights
+ * reordering run again on import. The implementation types selected for the nodes are stored together with
+ * the CPU ISA and are preferred on import on a CPU with the same ISA, on other CPUs they are selected again.
+ * Networks with TensorIterator or Loop layers cannot be exported, NOT_IMPLEMENTED exception is thrown.
+ */
+void ExportNetwork(std::ostream& stream, const ExportedNetwork& exported);
+
+/**
+ * @brief Reads an executable network written by ExportNetwork.
+ * The stored implementation types are set as primitives priorities of the network layers, they are not returned
+ * in ExportedNetwork::primitives. Reading requires the optional IR v7 reader library.
+ * @param stream Stream to read from
+ * @param core Core used to read the IR v7 representation of the transformed network
+ */
+ExportedNetwork ImportNetwork(std::istream& stream, const InferenceEngine::ICore* core);
+
+}  // namespace MKLDNNPlugin
@@ -9,8 +9,6 @@
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
-
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
@@ -36,39 +34,53 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
                             const std::string& key,
                             std::function<MKLDNNMemoryPtr(void)> create,
                             bool valid) {
-    std::unique_lock<std::mutex> lock(guard);
-    auto found = sharedWeights.find(key);
-
     MKLDNNMemoryInfo::Ptr ptr;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = sharedWeights[key];
+        if (!found)
+            found = std::make_shared<MKLDNNMemoryInfo>(nullptr, valid);
+        ptr = found;
+    }
+
+    // Streams initializing different weights don't wait for each other,
+    // while the ones requesting the same key wait until the memory is created
+    std::unique_lock<std::mutex> entryLock(ptr->guard);
     MKLDNNMemoryPtr newPtr;
 
-    if (found == sharedWeights.end()
-        || !(ptr = found->second)
-        || ptr->sharedMemory.expired()) {
+    if (ptr->sharedMemory.expired()) {
         newPtr = create();
-        ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
-        sharedWeights[key] = ptr;
+        ptr->sharedMemory = newPtr;
+        ptr->valid = valid;
     }
 
-    return std::make_shared<MKLDNNSharedMemory>(ptr->valid
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    // invalid memory stays locked until its content is computed by the owner of the returned object
+    if (ptr->valid)
+        entryLock.unlock();
+
+    return std::make_shared<MKLDNNSharedMemory>(std::move(entryLock), ptr, newPtr);
 }
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
-    std::unique_lock<std::mutex> lock(guard);
-    auto found = sharedWeights.find(key);
-
     MKLDNNMemoryInfo::Ptr ptr;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = sharedWeights.find(key);
+        if (found != sharedWeights.end())
+            ptr = found->second;
+    }
 
-    if (found == sharedWeights.end()
-        || !(ptr = found->second)
-        || ptr->sharedMemory.expired())
+    if (!ptr)
         THROW_IE_EXCEPTION << "Unknown shared memory with key " << key;
 
-    return std::make_shared<MKLDNNSharedMemory>(ptr->valid
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr);
+    std::unique_lock<std::mutex> entryLock(ptr->guard);
+    if (ptr->sharedMemory.expired())
+        THROW_IE_EXCEPTION << "Unknown shared memory with key " << key;
+
+    if (ptr->valid)
+        entryLock.unlock();
+
+    return std::make_shared<MKLDNNSharedMemory>(std::move(entryLock), ptr);
 }
 
 NumaNodesWeights::NumaNodesWeights() {
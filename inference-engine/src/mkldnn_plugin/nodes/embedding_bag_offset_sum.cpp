@@ -4,7 +4,10 @@
 
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
 
+#include <atomic>
+#include <string>
 #include <vector>
 
 
@@ -40,10 +43,17 @@ public:
             case Precision::FP32: {
                 return processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
             }
+            case Precision::BF16: {
+                return processData<MKLDNNPlugin::bfloat16_t, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
+            }
             case Precision::I8: {
+                if (_withDequantization)
+                    return processData<PrecisionTrait<Precision::I8>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
                 return processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs, resp);
             }
             case Precision::U8: {
+                if (_withDequantization)
+                    return processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
                 return processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs, resp);
             }
             case Precision::I32: {
@@ -61,20 +71,20 @@ public:
     }
 
 protected:
-    template<typename T>
+    template<typename T, typename A = T>
     StatusCode processData(
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
                 ResponseDesc* resp) noexcept {
         switch (inputs[1]->getTensorDesc().getPrecision()) {
             case Precision::I32: {
-                return processData<T, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
+                return processData<T, A, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
             }
             case Precision::I64: {
-                return processData<T, PrecisionTrait<Precision::I64>::value_type>(inputs, outputs, resp);
+                return processData<T, A, PrecisionTrait<Precision::I64>::value_type>(inputs, outputs, resp);
             }
             case Precision::U64: {
-                return processData<T, PrecisionTrait<Precision::U64>::value_type>(inputs, outputs, resp);
+                return processData<T, A, PrecisionTrait<Precision::U64>::value_type>(inputs, outputs, resp);
             }
             default: {
                 if (resp) {
@@ -87,7 +97,7 @@ protected:
         }
     }
 
-    template<typename T, typename I>
+    template<typename T, typename A, typename I>
     StatusCode processData(
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
@@ -97,130 +107,73 @@ protected:
 
         const T* srcData = inputs[0]->cbuffer().as<const T*>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        T* dstData = outputs[0]->buffer().as<T*>() +
+        A* dstData = outputs[0]->buffer().as<A*>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         const I* indicesData = inputs[INDICES_IDX]->cbuffer().as<const I*>();
 
         const I* offsetsData = inputs[OFFSETS_IDX]->cbuffer().as<const I*>();
-        int64_t defaultIndex = -1;
-        if (inputs.size() > DEFAULT_INDEX_IDX) {
-            defaultIndex = (int64_t)inputs[DEFAULT_INDEX_IDX]->cbuffer().as<const I*>()[0];
-            if (defaultIndex < 0 || defaultIndex >= _indicesLen) {
+        I defaultIndex = 0;
+        const bool withDefaultIndex = inputs.size() > DEFAULT_INDEX_IDX;
+        if (withDefaultIndex) {
+            defaultIndex = inputs[DEFAULT_INDEX_IDX]->cbuffer().as<const I*>()[0];
+            if (static_cast<int64_t>(defaultIndex) < 0 || static_cast<size_t>(defaultIndex) >= _indicesLen) {
                 std::string msg =  "Invalid default index: " + std::to_string(defaultIndex);
                 msg.copy(resp->msg, sizeof(resp->msg) - 1);
                 return GENERAL_ERROR;
             }
         }
-        const T* weightsData = nullptr;
+        const A* weightsData = nullptr;
         if (_withWeights)
-            weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+            weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const A*>();
 
         const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
 
         const size_t OUTPUT_BAGS_NUM = outputs[0]->getTensorDesc().getDims()[0];
+        if (OUTPUT_BAGS_NUM > _offsetsLen) {
+            errorMsg = msgPrefix + "has invalid embedding bag index.";
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            return GENERAL_ERROR;
+        }
 
-        std::function<void(size_t, const I*&, size_t&, size_t&, bool&)> get_idx =
-                [&](size_t embIndex, const I*& indicesRef, size_t& outSize, size_t& weightsIdx, bool& withWeights) {
-            if (embIndex >= _offsetsLen) {
-                errorMsg = msgPrefix + "has invalid embedding bag index.";
+        std::atomic<bool> failed(false);
+        parallelForBags(OUTPUT_BAGS_NUM, [&](size_t obi) {
+            if (failed)
                 return;
-            }
-            if (offsetsData[embIndex] >= _indicesLen) {
-                errorMsg = msgPrefix + ". Offset value exceeds indices size in the model.\noffset: "
-                    + std::to_string(offsetsData[embIndex]) + "; indices size: " + std::to_string(_indicesLen);
+
+            A* dst = dstData + obi * _embDepth;
+            if (static_cast<size_t>(offsetsData[obi]) >= _indicesLen) {
+                if (!failed.exchange(true))
+                    errorMsg = msgPrefix + ". Offset value exceeds indices size in the model.\noffset: "
+                        + std::to_string(offsetsData[obi]) + "; indices size: " + std::to_string(_indicesLen);
                 return;
             }
 
-            indicesRef = nullptr;
-            outSize = 0lu;
-            withWeights = _withWeights;
-
-            if (embIndex == _offsetsLen - 1lu)
-                outSize = _indicesLen - offsetsData[embIndex];
-            else
-                outSize = offsetsData[embIndex + 1lu] - offsetsData[embIndex];
+            const I* indices = indicesData + offsetsData[obi];
+            size_t indicesSize = (obi == _offsetsLen - 1lu ? _indicesLen : offsetsData[obi + 1lu]) - offsetsData[obi];
+            const A* weights = _withWeights ? weightsData + offsetsData[obi] : nullptr;
 
-            if (outSize != 0lu) {
-                indicesRef = indicesData + offsetsData[embIndex];
-            } else {
             // Empty or default bag
-                withWeights = false;
-                if (defaultIndex >= 0) {
-                    indicesRef = reinterpret_cast<I*>(&defaultIndex);
-                    outSize = 1lu;
+            if (indicesSize == 0lu) {
+                weights = nullptr;
+                if (withDefaultIndex) {
+                    indices = &defaultIndex;
+                    indicesSize = 1lu;
                 }
-                return;
             }
 
-            if (withWeights)
-                weightsIdx = offsetsData[embIndex];
-        };
-
-        auto threadBody = [&](const int ithr, const int nthr) {
-            size_t start(0lu), end(0lu);
-            splitter(OUTPUT_BAGS_NUM, nthr, ithr, start, end);
-            if (start >= end)
-                return;
-
-            size_t indicesSize = 0lu;
-            const I* indices = nullptr;
-            size_t weightsIdx = 0lu;
-            bool withWeights = _withWeights;
-
-            for (size_t obi = start; obi < end; obi++) {
-                size_t dstIndex = obi * _embDepth;
-                get_idx(obi, indices, indicesSize, weightsIdx, withWeights);
-                if (indices != nullptr) {
-                    withWeights = withWeights & _withWeights;
-
-                    size_t inIdx = 0lu;
-                    if (indices[inIdx] >= inDataDims[0]) {
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    if (!failed.exchange(true))
                         errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                        return;
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i];
-                        }
-                    }
-
-                    for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                        if (indices[inIdx] >= inDataDims[0]) {
-                            errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                            return;
-                        }
-                        size_t srcIndex = indices[inIdx] * _embDepth;
-
-                        if (withWeights) {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                            }
-                            weightsIdx++;
-                        } else {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i];
-                            }
-                        }
-                    }
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = 0;
-                    }
+                    return;
                 }
             }
-        };
 
-        parallel_nt(0, threadBody);
+            sumBag(srcData, indices, indicesSize, weights, dst, _embDepth, _withDequantization ? &_dequantization : nullptr);
+        });
 
-        if (!errorMsg.empty()) {
+        if (failed) {
             errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
             return GENERAL_ERROR;
         }
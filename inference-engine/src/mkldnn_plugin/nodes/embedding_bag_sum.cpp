@@ -5,6 +5,7 @@
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
 #include "list.hpp"
+#include "utils/bfloat16.hpp"
 
 #include <set>
 #include <string>
@@ -50,6 +51,23 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
                 THROW_IE_EXCEPTION << logPrefix << "has unsupported precision: " << dataPrecision.name();
         }
 
+        // compressed table, the dequantization is fused by the plugin (see FuseEmbeddingTableDecompression)
+        auto scalesIt = layer->blobs.find("dequantization_scales");
+        auto shiftsIt = layer->blobs.find("dequantization_shifts");
+        if (scalesIt != layer->blobs.end() && shiftsIt != layer->blobs.end()) {
+            const size_t rows = inData->getTensorDesc().getDims()[0];
+            for (const auto& blob : {scalesIt->second, shiftsIt->second}) {
+                if (blob->getTensorDesc().getPrecision() != Precision::FP32 || (blob->size() != 1lu && blob->size() != rows))
+                    THROW_IE_EXCEPTION << logPrefix << "has invalid dequantization parameters.";
+            }
+            const float* scales = scalesIt->second->cbuffer().as<const float*>();
+            const float* shifts = shiftsIt->second->cbuffer().as<const float*>();
+            _dequantization.scales.assign(scales, scales + scalesIt->second->size());
+            _dequantization.shifts.assign(shifts, shifts + shiftsIt->second->size());
+            _withDequantization = true;
+            dataPrecision = Precision::FP32;
+        }
+
         if (layer->insData.size() > PER_SAMPLE_WEIGHTS_IDX)
             _withWeights = true;
         if (_withWeights) {
@@ -67,7 +85,8 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
             if (data == nullptr)
                 THROW_IE_EXCEPTION << logPrefix << "has nullable input data";
             auto prc = data->getTensorDesc().getPrecision();
-            if (prc == Precision::BF16)
+            // BF16 embedding table is read as is to halve the memory traffic, the rows are accumulated in FP32
+            if (prc == Precision::BF16 && i != 0)
                 prc = Precision::FP32;
             config.inConfs[i].desc = TensorDesc(prc,
                 data->getTensorDesc().getDims(),
@@ -103,12 +122,22 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
             processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
             break;
         }
+        case Precision::BF16: {
+            processData<MKLDNNPlugin::bfloat16_t, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
+            break;
+        }
         case Precision::I8: {
-            processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
+            if (_withDequantization)
+                processData<PrecisionTrait<Precision::I8>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
+            else
+                processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
             break;
         }
         case Precision::U8: {
-            processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
+            if (_withDequantization)
+                processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
+            else
+                processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
             break;
         }
         case Precision::I32: {
@@ -128,82 +157,42 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
     return OK;
 }
 
-template<typename T>
+template<typename T, typename A>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs) noexcept {
     const T* srcData = inputs[0]->cbuffer().as<const T*>() +
         inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    T* dstData = outputs[0]->buffer().as<T*>() +
+    A* dstData = outputs[0]->buffer().as<A*>() +
         outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    const T* weightsData = nullptr;
+    const A* weightsData = nullptr;
     if (_withWeights)
-        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const A*>();
     initFromInputs(inputs);
 
     const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
 
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
+    parallelForBags(outputBagsNum, [&](size_t obi) {
         size_t indicesSize = 0lu;
         const size_t* indices = nullptr;
         size_t weightsIdx = 0lu;
         bool withWeights = _withWeights;
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
-                        THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
-            }
+        A* dst = dstData + obi * _embDepth;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+        if (indices == nullptr)
+            indicesSize = 0lu;
+        for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+            if (indices[inIdx] >= inDataDims[0])
+                THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
+                    << "' has invalid embedding bag index: " << indices[inIdx];
         }
-    };
 
-    parallel_nt(0, threadBody);
+        withWeights = withWeights & _withWeights;
+        sumBag(srcData, indices, indicesSize, withWeights ? weightsData + weightsIdx : nullptr, dst, _embDepth,
+               _withDequantization ? &_dequantization : nullptr);
+    });
 }
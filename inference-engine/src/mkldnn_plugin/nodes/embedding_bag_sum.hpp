@@ -5,11 +5,18 @@
 #pragma once
 
 #include "base.hpp"
+#include "ie_parallel.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <set>
 #include <vector>
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
@@ -38,9 +45,40 @@ protected:
         size_t& weightsIdx,
         bool& withWeights) = 0;
 
-    template<typename T>
+    template<typename T, typename A = T>
     void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
 
+    /**
+     * Affine dequantization of the compressed embedding table: row = scale * table_row + shift.
+     * Holds either one value for the whole table or one value per table row.
+     */
+    struct Dequantization {
+        std::vector<float> scales;
+        std::vector<float> shifts;
+
+        float scale(size_t row) const { return scales.size() == 1lu ? scales[0] : scales[row]; }
+        float shift(size_t row) const { return shifts.size() == 1lu ? shifts[0] : shifts[row]; }
+    };
+
+    /**
+     * Sums the embedding table rows selected by the bag indices into dst, optionally scaled by the per sample weights.
+     * Rows are accumulated in the type A, the rows of the following indices are prefetched while the current one is summed.
+     * Compressed rows are dequantized on the fly if dequantization is not null.
+     * Indices have to be validated by the caller.
+     */
+    template<typename T, typename A, typename I>
+    static void sumBag(const T* srcData, const I* indices, size_t indicesSize, const A* weights, A* dst, size_t embDepth,
+                       const Dequantization* dequantization = nullptr);
+
+    /**
+     * Runs func(bagIndex) for every bag on all the threads. Bags are taken by small chunks from the shared counter,
+     * so the threads which got short bags take more of them and skewed bag sizes don't stall the whole layer.
+     */
+    template<typename F>
+    static void parallelForBags(size_t bagsNum, const F& func);
+
+    static const size_t _prefetchDistance = 8lu;
+
     std::set<Precision> _supportedPrecisions;
 
     const size_t INDICES_IDX;
@@ -48,6 +86,8 @@ protected:
     const size_t DEFAULT_INDEX_IDX;
 
     bool _withWeights = false;
+    bool _withDequantization = false;
+    Dequantization _dequantization;
     size_t _embDepth = 0;
     std::string _layerName;
 
@@ -58,6 +98,78 @@ protected:
     static const std::set<size_t> _supportedIndicesTypeSize;
 };
 
+template<typename T, typename A, typename I>
+void MKLDNNEmbeddingBagSum::sumBag(const T* srcData, const I* indices, size_t indicesSize, const A* weights, A* dst, size_t embDepth,
+                                   const Dequantization* dequantization) {
+    static const size_t cacheLineSize = 64lu;
+    const size_t rowSize = embDepth * sizeof(T);
+
+    for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+        if (inIdx + _prefetchDistance < indicesSize) {
+            const char* row = reinterpret_cast<const char*>(srcData + static_cast<size_t>(indices[inIdx + _prefetchDistance]) * embDepth);
+            for (size_t offset = 0lu; offset < rowSize; offset += cacheLineSize) {
+#if defined(_MSC_VER) && !defined(__clang__)
+                _mm_prefetch(row + offset, _MM_HINT_T0);
+#else
+                __builtin_prefetch(row + offset);
+#endif
+            }
+        }
+
+        const size_t row = static_cast<size_t>(indices[inIdx]);
+        const T* src = srcData + row * embDepth;
+        if (dequantization != nullptr) {
+            const float weight = weights != nullptr ? static_cast<float>(weights[inIdx]) : 1.f;
+            const A scale = static_cast<A>(weight * dequantization->scale(row));
+            const A shift = static_cast<A>(weight * dequantization->shift(row));
+            if (inIdx == 0lu) {
+                for (size_t i = 0lu; i < embDepth; i++)
+                    dst[i] = static_cast<A>(src[i]) * scale + shift;
+            } else {
+                for (size_t i = 0lu; i < embDepth; i++)
+                    dst[i] += static_cast<A>(src[i]) * scale + shift;
+            }
+        } else if (weights != nullptr) {
+            const A weight = weights[inIdx];
+            if (inIdx == 0lu) {
+                for (size_t i = 0lu; i < embDepth; i++)
+                    dst[i] = static_cast<A>(src[i]) * weight;
+            } else {
+                for (size_t i = 0lu; i < embDepth; i++)
+                    dst[i] += static_cast<A>(src[i]) * weight;
+            }
+        } else {
+            if (inIdx == 0lu) {
+                for (size_t i = 0lu; i < embDepth; i++)
+                    dst[i] = static_cast<A>(src[i]);
+            } else {
+                for (size_t i = 0lu; i < embDepth; i++)
+                    dst[i] += static_cast<A>(src[i]);
+            }
+        }
+    }
+
+    if (indicesSize == 0lu) {
+        for (size_t i = 0lu; i < embDepth; i++)
+            dst[i] = static_cast<A>(0);
+    }
+}
+
+template<typename F>
+void MKLDNNEmbeddingBagSum::parallelForBags(size_t bagsNum, const F& func) {
+    const size_t maxThreads = static_cast<size_t>(parallel_get_max_threads());
+    const size_t chunkSize = std::max(bagsNum / (maxThreads * 16lu), size_t(1lu));
+    std::atomic<size_t> nextBag(0lu);
+
+    parallel_nt(0, [&](const int, const int) {
+        for (size_t start = nextBag.fetch_add(chunkSize); start < bagsNum; start = nextBag.fetch_add(chunkSize)) {
+            const size_t end = std::min(start + chunkSize, bagsNum);
+            for (size_t obi = start; obi < end; obi++)
+                func(obi);
+        }
+    });
+}
+
 }  // namespace Cpu
 }  // namespace Extensions
 }  // namespace InferenceEngine
@@ -13,6 +13,7 @@
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/fp16_utils.h"
+#include "utils/bfloat16.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -53,6 +54,26 @@ public:
             LayerConfig config;
             DataConfig dataConfigIdx, dataConfigDct;
             Precision dataPrecision = layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getPrecision();
+            Precision outPrecision = dataPrecision;
+
+            // compressed dictionary, the dequantization is fused by the plugin (see FuseEmbeddingTableDecompression)
+            auto scalesIt = layer->blobs.find("dequantization_scales");
+            auto shiftsIt = layer->blobs.find("dequantization_shifts");
+            if (scalesIt != layer->blobs.end() && shiftsIt != layer->blobs.end()) {
+                if (axis != 0 || (dataPrecision != Precision::I8 && dataPrecision != Precision::U8 && dataPrecision != Precision::BF16))
+                    THROW_IE_EXCEPTION << layer->name << " Dequantization is supported only for I8, U8 and BF16 dictionaries along axis 0!";
+                for (const auto& blob : {scalesIt->second, shiftsIt->second}) {
+                    if (blob->getTensorDesc().getPrecision() != Precision::FP32 || (blob->size() != 1 && blob->size() != indexRange))
+                        THROW_IE_EXCEPTION << layer->name << " Incorrect dequantization parameters!";
+                }
+                const float* scales = scalesIt->second->cbuffer().as<const float*>();
+                const float* shifts = shiftsIt->second->cbuffer().as<const float*>();
+                dqScales.assign(scales, scales + scalesIt->second->size());
+                dqShifts.assign(shifts, shifts + shiftsIt->second->size());
+                withDequantization = true;
+                outPrecision = Precision::FP32;
+            }
+
             dataConfigDct.desc = TensorDesc(dataPrecision, dictionary_dims,
                     layer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getLayoutByDims(dictionary_dims));
             config.inConfs.push_back(dataConfigDct);
@@ -63,7 +84,7 @@ public:
 
             DataConfig dataConfigOut;
             const SizeVector& out_dims = layer->outData[0]->getTensorDesc().getDims();
-            dataConfigOut.desc = TensorDesc(dataPrecision, out_dims,
+            dataConfigOut.desc = TensorDesc(outPrecision, out_dims,
                     layer->outData[0]->getTensorDesc().getLayoutByDims(out_dims));
             config.outConfs.push_back(dataConfigOut);
             config.dynBatchSupport = false;
@@ -92,6 +113,19 @@ public:
     };
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        if (withDequantization) {
+            switch (inputs[GATHER_INDEXES]->getTensorDesc().getPrecision()) {
+                case Precision::FP32:
+                    return gatherDequantized<float, f32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                case Precision::FP16:
+                    return gatherDequantized<ie_fp16, f16toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                case Precision::I32:
+                    return gatherDequantized<int32_t, i32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
+                default:
+                    return GENERAL_ERROR;
+            }
+        }
+
         switch (inputs[GATHER_INDEXES]->getTensorDesc().getPrecision()) {
             case Precision::FP32:
                 gather<float, f32toUi32>(inputs[GATHER_INDEXES], inputs[GATHER_DICTIONARY], outputs[0]);
@@ -110,6 +144,49 @@ public:
     }
 
 private:
+    template <typename index_t, class Conversion>
+    StatusCode gatherDequantized(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
+        switch (dictionary->getTensorDesc().getPrecision()) {
+            case Precision::I8:
+                gatherDequantized<index_t, Conversion, int8_t>(indexes, dictionary, output);
+                break;
+            case Precision::U8:
+                gatherDequantized<index_t, Conversion, uint8_t>(indexes, dictionary, output);
+                break;
+            case Precision::BF16:
+                gatherDequantized<index_t, Conversion, MKLDNNPlugin::bfloat16_t>(indexes, dictionary, output);
+                break;
+            default:
+                return GENERAL_ERROR;
+        }
+        return OK;
+    }
+
+    //  Decompresses the gathered rows of a single dictionary, the dictionary itself is never expanded to FP32
+    template <typename index_t, class Conversion, typename data_t>
+    void gatherDequantized(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
+        size_t src_indexSize = indexes->size();
+        const index_t *src_index = indexes->cbuffer().as<const index_t *>() + indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const data_t *src_dataDict = dictionary->cbuffer().as<const data_t *>() + dictionary->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        float *dst_data = output->buffer().as<float *>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+        parallel_for(src_indexSize, [&](size_t i) {
+            unsigned int idx = Conversion()(src_index[i]);
+            float *dst = &dst_data[dataLength * i];
+
+            //  Index clipping
+            if (idx < indexRange) {
+                const data_t *src = &src_dataDict[dataLength * idx];
+                const float scale = dqScales.size() == 1 ? dqScales[0] : dqScales[idx];
+                const float shift = dqShifts.size() == 1 ? dqShifts[0] : dqShifts[idx];
+                for (size_t j = 0; j < dataLength; j++)
+                    dst[j] = static_cast<float>(src[j]) * scale + shift;
+            } else {
+                std::fill(dst, dst + dataLength, 0.f);
+            }
+        });
+    }
+
     template <typename index_t, class Conversion>
     void gather(Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output) {
         size_t src_indexSize = indexes->size();
@@ -139,6 +216,9 @@ private:
     }
 
     int axis = 0;
+    bool withDequantization = false;
+    std::vector<float> dqScales;
+    std::vector<float> dqShifts;
     size_t numDictionaries = 1;
     size_t indexRange = 0;
     size_t dataLength = 1;
@@ -0,0 +1,218 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <legacy/ie_layers.h>
+#include <ie_parallel.hpp>
+#include <mkldnn_extension_utils.h>
+#include "common/tensor_desc_creator.h"
+#include "utils/general_utils.h"
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+#define THROW_ERROR THROW_IE_EXCEPTION << getTypeStr() << " node with name '" << getName() << "' "
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {
+    snippet = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(layer->getNode());
+    if (!snippet)
+        THROW_ERROR << "doesn't contain snippets::op::Subgraph";
+
+    isa = mayiuse(avx512_common) ? avx512_common : avx2;
+}
+
+void MKLDNNSnippetNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != snippet->get_input_size())
+        THROW_ERROR << "has incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_ERROR << "has incorrect number of output edges";
+    if (snippet->get_input_size() + snippet->get_output_size() > jit_snippets_call_args::max_io_num)
+        THROW_ERROR << "has too many inputs and outputs";
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto& creators = TensorDescCreator::getCommonCreators();
+    auto& planarCreator = creators.at(TensorDescCreatorTypes::ncsp);
+
+    LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < inDims.size(); i++) {
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = planarCreator->createDesc(Precision::FP32, inDims[i].ToSizeVector());
+        config.inConfs.push_back(dataConfig);
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = planarCreator->createDesc(Precision::FP32, outDims[i].ToSizeVector());
+        config.outConfs.push_back(dataConfig);
+    }
+
+    impl_desc_type impl_type = isa == avx512_common ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+    supportedPrimitiveDescriptors.emplace_back(config, impl_type, MKLDNNMemoryDesc(config.outConfs.front().desc).getFormat());
+}
+
+void MKLDNNSnippetNode::prepareExecutionDomain() {
+    std::vector<std::vector<size_t>> dims;
+    for (size_t i = 0; i < inDims.size(); i++)
+        dims.push_back(inDims[i].ToSizeVector());
+    for (size_t i = 0; i < outDims.size(); i++)
+        dims.push_back(outDims[i].ToSizeVector());
+
+    const auto outputDims = outDims[0].ToSizeVector();
+    const size_t rank = std::max<size_t>(outputDims.size(), 1);
+    std::vector<size_t> fullDomain(rank - outputDims.size(), 1);
+    fullDomain.insert(fullDomain.end(), outputDims.begin(), outputDims.end());
+
+    for (auto& d : dims) {
+        if (d.size() > rank)
+            THROW_ERROR << "has input with rank greater than output rank";
+        d.insert(d.begin(), rank - d.size(), 1);
+    }
+    for (size_t i = inDims.size(); i < dims.size(); i++) {
+        if (dims[i] != fullDomain)
+            THROW_ERROR << "has outputs with different shapes";
+    }
+
+    // Walk from the innermost dimension and merge a dimension into the previous one
+    // if it is broadcasted (or not) for all the inputs the same way, so planar tensors without broadcasting
+    // become a single long row which is processed by one kernel call per thread
+    domain.clear();
+    ioDims.assign(dims.size(), {});
+    for (int d = static_cast<int>(rank) - 1; d >= 0; d--) {
+        bool canMerge = !domain.empty();
+        if (canMerge && fullDomain[d] != 1 && domain.front() != 1) {
+            for (size_t i = 0; i < dims.size(); i++) {
+                if ((dims[i][d] == 1) != (ioDims[i].front() == 1)) {
+                    canMerge = false;
+                    break;
+                }
+            }
+        }
+
+        if (canMerge) {
+            domain.front() *= fullDomain[d];
+            for (size_t i = 0; i < dims.size(); i++)
+                ioDims[i].front() *= dims[i][d];
+        } else {
+            domain.insert(domain.begin(), fullDomain[d]);
+            for (size_t i = 0; i < dims.size(); i++)
+                ioDims[i].insert(ioDims[i].begin(), dims[i][d]);
+        }
+    }
+
+    ioStrides.assign(dims.size(), std::vector<size_t>(domain.size(), 0));
+    for (size_t i = 0; i < dims.size(); i++) {
+        size_t stride = 1;
+        for (int d = static_cast<int>(domain.size()) - 1; d >= 0; d--) {
+            ioStrides[i][d] = ioDims[i][d] == 1 ? 0 : stride;
+            stride *= ioDims[i][d];
+        }
+    }
+
+    // When outer dimensions don't provide enough parallelism the innermost one is split into blocks
+    const size_t innerDim = domain.back();
+    const size_t outerWork = std::accumulate(domain.begin(), domain.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const size_t minBlock = 4 * generator->get_vec_length();
+    innerBlock = innerDim;
+    if (outerWork < nthr) {
+        const size_t blocksPerRow = div_up(nthr, outerWork);
+        innerBlock = std::min(innerDim, std::max(minBlock, rnd_up(div_up(innerDim, blocksPerRow), generator->get_vec_length())));
+    }
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_ERROR << "has unidentified preferable primitive descriptor";
+    if (schedule.ptr != nullptr)
+        return;
+
+    generator = std::make_shared<CPUGenerator>(isa);
+    prepareExecutionDomain();
+
+    // code is generated for the collapsed shapes, padded up to the rank expected by snippets canonicalization
+    const size_t genRank = std::max<size_t>(domain.size(), 4);
+    auto toBlockedShape = [genRank](const std::vector<size_t>& dims) {
+        ngraph::Shape shape(genRank - dims.size(), 1);
+        shape.insert(shape.end(), dims.begin(), dims.end());
+        ngraph::AxisVector order(genRank);
+        std::iota(order.begin(), order.end(), 0);
+        return ngraph::snippets::op::Subgraph::BlockedShape{shape, order, ngraph::element::f32};
+    };
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes;
+    for (size_t i = 0; i < inDims.size(); i++)
+        inputShapes.push_back(toBlockedShape(ioDims[i]));
+    for (size_t i = inDims.size(); i < ioDims.size(); i++)
+        outputShapes.push_back(toBlockedShape(ioDims[i]));
+
+    snippetCanonical = snippet->make_canonical_from_this();
+    snippetCanonical->set_generator(generator);
+    auto body = snippetCanonical->get_body();
+    for (size_t i = 0; i < inputShapes.size(); i++) {
+        body->replace_parameter(i, std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, std::get<0>(inputShapes[i])));
+    }
+
+    schedule = snippetCanonical->generate(outputShapes, inputShapes);
+    if (schedule.ptr == nullptr)
+        THROW_ERROR << "failed to generate kernel";
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    const size_t numInputs = inDims.size();
+    std::vector<const uint8_t*> ptrs(ioDims.size());
+    for (size_t i = 0; i < numInputs; i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    for (size_t i = numInputs; i < ptrs.size(); i++)
+        ptrs[i] = reinterpret_cast<const uint8_t*>(getChildEdgesAtPort(i - numInputs)[0]->getMemoryPtr()->GetPtr());
+
+    auto kernel = reinterpret_cast<void (*)(const jit_snippets_call_args*)>(schedule.ptr);
+
+    const size_t outerRank = domain.size() - 1;
+    const size_t innerDim = domain.back();
+    const size_t outerWork = std::accumulate(domain.begin(), domain.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t innerChunks = div_up(innerDim, innerBlock);
+
+    parallel_for2d(outerWork, innerChunks, [&](size_t outer, size_t chunk) {
+        const size_t start = chunk * innerBlock;
+
+        jit_snippets_call_args args;
+        for (size_t i = 0; i < ptrs.size(); i++) {
+            const auto& strides = ioStrides[i];
+            size_t offset = start * strides[outerRank];
+            size_t idx = outer;
+            for (int d = static_cast<int>(outerRank) - 1; d >= 0; d--) {
+                offset += (idx % domain[d]) * strides[d];
+                idx /= domain[d];
+            }
+            args.io[i] = ptrs[i] + offset * sizeof(float);
+        }
+        args.work_amount = std::min(innerBlock, innerDim - start);
+
+        kernel(&args);
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <snippets/op/subgraph.hpp>
+#include "emitters/cpu_generator.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/// MKLDNNSnippetNode executes a subgraph of elementwise operations collapsed by snippets::pass::TokenizeSnippets
+/// as a single JIT kernel produced by CPUGenerator. The kernel processes the innermost dimension,
+/// while the node iterates over the outer dimensions and resolves broadcasting via input strides.
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+private:
+    // collapses adjacent dimensions which are broadcasted the same way for all the inputs and outputs
+    void prepareExecutionDomain();
+
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippetCanonical;
+    std::shared_ptr<CPUGenerator> generator;
+    ngraph::snippets::Schedule schedule;
+
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+
+    // collapsed output dimensions and strides (in elements) of every input and output, 0 for broadcasted dimensions
+    std::vector<size_t> domain;
+    std::vector<std::vector<size_t>> ioDims;
+    std::vector<std::vector<size_t>> ioStrides;
+    size_t innerBlock = 0;
+};
+
+}  // namespace MKLDNNPlugin
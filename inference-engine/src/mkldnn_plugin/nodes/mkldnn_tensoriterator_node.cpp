@@ -6,11 +6,15 @@
 
 #include <legacy/ie_layers.h>
 #include <legacy/ie_layers_internal.hpp>
+#include <legacy/net_pass.h>
+#include <legacy/graph_tools.hpp>
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <ie_parallel.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -47,42 +51,94 @@ static InferenceEngine::LayerConfig make_plain_config(const InferenceEngine::CNN
     return config;
 }
 
-class PortIteratorHelper : public PortMapHelper {
-public:
-    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
-                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng)
-                       : sliced_src(sliced_src) {
-        const auto &full_blob = sliced_src ? from : to;
-        const auto &part_blob = !sliced_src ? from : to;
+// special purpose ports
+constexpr auto key_cur_iter_port = "loop_body_current_iteration_idx";
+constexpr auto key_cond_port = "loop_body_condition_output_idx";
+constexpr auto key_trip_count_port = "loop_trip_count_idx";
+constexpr auto key_init_cond_port = "loop_execution_condition_idx";
+
+/**
+ * Batch sub-slice [offset, offset + size) of the TI inputs and outputs processed by one body.
+ */
+struct BatchSlice {
+    int offset;
+    int size;
+};
+
+/**
+ * Placement of the per iteration chunks inside of the plain TI input or output tensor.
+ * axis == -1 means the whole (batch sliced) tensor is used on each iteration.
+ */
+struct ChunkLayout {
+    ChunkLayout(const MKLDNNMemoryPtr &full_blob, int axis, int stride, const BatchSlice &batch_slice) {
+        const auto full_dims = full_blob->GetDims();
+
+        desc = full_blob->GetDescriptor();
+        const auto &strides = desc.data.format_desc.blocking.strides;
+        const auto elem_size = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(desc.data.data_type));
+
+        const bool plain = MKLDNNMemoryDesc(full_blob->GetDescriptor()).isPlainFormat();
+        if (batch_slice.size != full_dims[0]) {
+            // the padded batch is equal to the real one only in the plain layout, see canSplitBatch()
+            IE_ASSERT(plain) << "Batch sub-slice of tensor iterator port requires plain layout";
+            desc.data.dims[0] = batch_slice.size;
+            desc.data.padded_dims[0] = batch_slice.size;
+            offset_in_byte = strides[0] * elem_size * batch_slice.offset;
+        }
 
-        auto axis = slice_rule.axis;
-        auto stride = slice_rule.stride;
+        // the chunk is a dense block of the plain tensor if all the dimensions before the sliced one are 1
+        dense = plain;
 
-        auto full_dims = full_blob->GetDims();
-        auto part_dims = part_blob->GetDims();
+        if (axis == -1)
+            return;
 
         auto abs_stride = std::abs(stride);
         auto sign_of_stride = stride < 0.0f ? -1 : 1;
 
         iter_count = full_dims[axis] / abs_stride;
 
-        full_dims[axis] = abs_stride;
-        IE_ASSERT(full_dims == part_dims) << "Shape mismatch for tensor iterator port";
+        desc.data.dims[axis] = abs_stride;
+        desc.data.padded_dims[axis] = abs_stride;  // TODO: asamption that plain tensor
 
-        // make chunk view
-        auto chunk_desc =  full_blob->GetDescriptor();
-        chunk_desc.data.dims[axis] = abs_stride;
-        chunk_desc.data.padded_dims[axis] = abs_stride;  // TODO: asamption that plain tensor
+        stride_in_byte = strides[axis] * elem_size * abs_stride;
+        offset_in_byte += sign_of_stride < 0 ? (iter_count - 1) * stride_in_byte : 0;
+        stride_in_byte *= sign_of_stride;
 
-        full_mem = full_blob->GetPrimitive();
-        const auto full_mem_handler = full_mem.get_data_handle();
-        mkldnn::memory chunk_mem = {chunk_desc, eng, full_mem_handler};
+        for (int i = 0; i < axis; i++)
+            dense &= desc.data.dims[i] == 1;
+    }
+
+    mkldnn::memory::dims dims() const {
+        return mkldnn::memory::dims(desc.data.dims, desc.data.dims + desc.data.ndims);
+    }
+
+    mkldnn::memory::desc desc;
+    ptrdiff_t stride_in_byte = 0;
+    ptrdiff_t offset_in_byte = 0;
+    int iter_count = 1;
+    bool dense = false;
+};
+
+class PortIteratorHelper : public PortMapHelper {
+public:
+    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
+                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const BatchSlice &batch_slice,
+                       const mkldnn::engine& eng)
+                       : sliced_src(sliced_src) {
+        const auto &full_blob = sliced_src ? from : to;
+        const auto &part_blob = !sliced_src ? from : to;
+
+        ChunkLayout chunk(full_blob, slice_rule.axis, slice_rule.stride, batch_slice);
+        IE_ASSERT(chunk.dims() == part_blob->GetDims()) << "Shape mismatch for tensor iterator port";
 
-        auto elem_size = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(chunk_desc.data.data_type));
+        iter_count = chunk.iter_count;
+        chunk_stride_in_byte = chunk.stride_in_byte;
+        chunk_offset_in_byte = chunk.offset_in_byte;
 
-        chunk_stride_in_byte = chunk_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
-        chunk_stride_in_byte *= sign_of_stride;
+        // make chunk view
+        full_mem = full_blob->GetPrimitive();
+        const auto full_mem_handler = full_mem.get_data_handle();
+        mkldnn::memory chunk_mem = {chunk.desc, eng, full_mem_handler};
 
         if (sliced_src) {
             mem_holder_src = chunk_mem;
@@ -114,6 +170,92 @@ private:
     int iter_count;
 };
 
+/**
+ * Zero-copy alternative of PortIteratorHelper. Points the body memory directly to the chunk
+ * of TI tensor, so the body reads the sliced input or writes the sliced output in place.
+ */
+class PortAliasHelper : public PortMapHelper {
+public:
+    PortAliasHelper(const MKLDNNMemoryPtr &full_blob, const std::vector<MKLDNNMemoryPtr> &part_blobs,
+                    const ChunkLayout &chunk)
+                    : chunk_stride_in_byte(chunk.stride_in_byte), chunk_offset_in_byte(chunk.offset_in_byte),
+                      iter_count(chunk.iter_count) {
+        full_mem = full_blob->GetPrimitive();
+        for (const auto &part_blob : part_blobs)
+            part_mems.push_back(part_blob->GetPrimitivePtr());
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &part_mem : part_mems)
+            part_mem->set_data_handle(chunk_ptr);
+    }
+
+    // body memory can be aliased if it has the same plain layout as the dense chunk of TI tensor
+    static bool isApplicable(const MKLDNNMemoryPtr &full_blob, const MKLDNNMemoryPtr &part_blob, const ChunkLayout &chunk) {
+        return chunk.dense &&
+               part_blob->GetDataType() == full_blob->GetDataType() &&
+               part_blob->GetDims() == chunk.dims() &&
+               part_blob->GetDescriptor().data.offset0 == 0 &&
+               MKLDNNMemoryDesc(part_blob->GetDescriptor()).isPlainFormat();
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    mkldnn::memory full_mem;
+    std::vector<std::shared_ptr<mkldnn::memory>> part_mems;
+
+    int iter_count;
+};
+
+/**
+ * Copies not sliced TI input to the body or the body output to not sliced TI output,
+ * when the body processes only a batch sub-slice of TI tensors.
+ */
+class BatchSlicePortHelper : public PortMapHelper {
+public:
+    BatchSlicePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
+                         const BatchSlice &batch_slice, const mkldnn::engine& eng)
+                         : sliced_src(sliced_src) {
+        const auto &full_blob = sliced_src ? from : to;
+        const auto &part_blob = !sliced_src ? from : to;
+
+        ChunkLayout chunk(full_blob, -1, 1, batch_slice);
+        IE_ASSERT(chunk.dims() == part_blob->GetDims()) << "Shape mismatch for tensor iterator port";
+        offset_in_byte = chunk.offset_in_byte;
+
+        full_mem = full_blob->GetPrimitive();
+        mkldnn::memory slice_mem = {chunk.desc, eng, full_mem.get_data_handle()};
+
+        if (sliced_src) {
+            mem_holder_src = slice_mem;
+            mem_holder_dst = to->GetPrimitive();
+        } else {
+            mem_holder_src = from->GetPrimitive();
+            mem_holder_dst = slice_mem;
+        }
+        reorder = {mem_holder_src, mem_holder_dst};
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        auto &slice_mem = sliced_src ? mem_holder_src : mem_holder_dst;
+        slice_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) + offset_in_byte);
+
+        reorder.execute(strm, mem_holder_src, mem_holder_dst);
+    }
+
+private:
+    ptrdiff_t offset_in_byte = 0;
+
+    bool sliced_src;
+    mkldnn::memory full_mem;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -195,24 +337,155 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
     n_iter = getNumIteration(*ti);
-    sub_graph.CreateGraph(ti->body, ext_mng, weightCache);
+    batch_split = getBatchSplit(*ti);
+
+    if (batch_split == 1) {
+        bodies.emplace_back(new Body());
+        createBody(*bodies.back(), ti->body);
+        return;
+    }
+
+    // every body processes its own batch sub-slice, so the body copies are reshaped to the sub-slice size
+    const auto batch = ti->insData[0].lock()->getDims()[0];
+    const auto sub_batch = batch / batch_split;
+    for (int i = 0; i < batch_split; i++) {
+        auto net = InferenceEngine::NetPass::CopyTIBody(ti->body, "_batch_slice" + std::to_string(i));
+
+        std::vector<InferenceEngine::DataPtr> all_data;
+        for (const auto &in_data : net.inputs) {
+            if (in_data->getPrecision() != InferenceEngine::Precision::UNSPECIFIED)
+                all_data.push_back(in_data);
+        }
+        for (const auto &layer : InferenceEngine::NetPass::TIBodySortTopologically(net))
+            all_data.insert(all_data.end(), layer->outData.begin(), layer->outData.end());
+
+        for (const auto &data : all_data) {
+            auto dims = data->getDims();
+            if (!dims.empty() && dims[0] == batch) {
+                dims[0] = sub_batch;
+                data->setDims(dims);
+            }
+        }
+
+        bodies.emplace_back(new Body());
+        createBody(*bodies.back(), net);
+    }
+}
+
+void MKLDNNTensorIteratorNode::createBody(Body &body, const InferenceEngine::TensorIterator::Body &net) {
+    body.graph.CreateGraph(net, ext_mng, weightCache);
 
     // Try to detect inputs and outputs by indexes
-    const auto &in_map = sub_graph.GetInputNodes();
-    for (const auto &in_data : ti->body.inputs) {
+    const auto &in_map = body.graph.GetInputNodes();
+    for (const auto &in_data : net.inputs) {
         if (in_data->getName() == "const_holder") continue;
 
         auto &in_node = in_map.at(in_data->getName());
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
-        input_mem.push_back(in_mem);
+        body.input_nodes.push_back(in_node);
+        body.input_mem.push_back(in_mem);
     }
 
     // Assume that order of outputs in original TI and produces sub_graph is same
-    const auto &out_vec = sub_graph.GetOutputNodes();
+    const auto &out_vec = body.graph.GetOutputNodes();
     for (size_t i = 0; i < out_vec.size(); i++) {
         auto out_mem = out_vec[i]->getParentEdgeAt(0)->getMemoryPtr();
-        output_mem.push_back(out_mem);
+        body.output_nodes.push_back(out_vec[i]);
+        body.output_mem.push_back(out_mem);
+    }
+}
+
+int MKLDNNTensorIteratorNode::getBatchSplit(const InferenceEngine::TensorIterator &ti) const {
+    // Loop special ports make iterations depend on the values computed for all batch elements
+    if (!ti.GetParamAsInts(key_cur_iter_port, {}).empty() || ti.GetParamAsInt(key_cond_port, -1) != -1 ||
+        ti.GetParamAsInt(key_trip_count_port, -1) != -1 || ti.GetParamAsInt(key_init_cond_port, -1) != -1)
+        return 1;
+
+    if (ti.insData.empty() || ti.insData[0].lock()->getDims().empty())
+        return 1;
+    const auto batch = ti.insData[0].lock()->getDims()[0];
+    const int split = std::min<int>(batch, parallel_get_max_threads());
+    if (split < 2)
+        return 1;
+
+    auto hasBatch = [batch](const InferenceEngine::DataPtr &data) {
+        return !data->getDims().empty() && data->getDims()[0] == batch;
+    };
+
+    for (const auto &in_data : ti.insData) {
+        if (!hasBatch(in_data.lock()))
+            return 1;
+    }
+    for (const auto &out_data : ti.outData) {
+        if (!hasBatch(out_data))
+            return 1;
+    }
+    for (const auto &port_map : {ti.input_port_map, ti.output_port_map}) {
+        for (const auto &map_rule : port_map) {
+            if (map_rule.axis == 0)
+                return 1;
+        }
+    }
+    for (const auto &in_data : ti.body.inputs) {
+        if (in_data->getPrecision() != InferenceEngine::Precision::UNSPECIFIED && !hasBatch(in_data))
+            return 1;
+    }
+
+    // Layers which process each batch element separately if the batch is their outermost dimension
+    static const std::set<Type> batch_independent_types = {
+        Eltwise, FullyConnected, RNNCell, Reshape, Flatten, Concatenation, Split, Copy, Convert
+    };
+    for (const auto &layer : InferenceEngine::NetPass::TIBodySortTopologically(ti.body)) {
+        const auto type = TypeFromName(layer->type);
+        if (type == Input) {
+            // constants are not sliced, so they must not contain batch dimension
+            for (const auto &out_data : layer->outData) {
+                if (hasBatch(out_data))
+                    return 1;
+            }
+            continue;
+        }
+
+        if (batch_independent_types.find(type) == batch_independent_types.end())
+            return 1;
+        if ((type == Concatenation || type == Split) && layer->GetParamAsInt("axis", 1) == 0)
+            return 1;
+
+        for (const auto &out_data : layer->outData) {
+            if (!hasBatch(out_data))
+                return 1;
+        }
+        // the second input of reshape is a target shape which is not sliced
+        const size_t data_inputs = type == Reshape ? 1 : layer->insData.size();
+        for (size_t i = 0; i < layer->insData.size(); i++) {
+            const auto in_data = layer->insData[i].lock();
+            const auto creator = InferenceEngine::getCreatorLayer(in_data).lock();
+            const bool is_const = creator && creator->type == "Const";
+            if (is_const ? hasBatch(in_data) : (i < data_inputs && !hasBatch(in_data)))
+                return 1;
+        }
     }
+
+    int sub_slices = split;
+    while (batch % sub_slices != 0)
+        sub_slices--;
+    return sub_slices;
+}
+
+bool MKLDNNTensorIteratorNode::canSplitBatch() const {
+    // batch sub-slices are addressed by the offset of the first element, so the batch must not be blocked
+    auto isPlain = [](const MKLDNNEdgePtr &edge) {
+        return MKLDNNMemoryDesc(edge->getMemory().GetDescriptor()).isPlainFormat();
+    };
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (!isPlain(getParentEdgeAt(i)))
+            return false;
+    }
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        if (!isPlain(getChildEdgeAt(i)))
+            return false;
+    }
+    return true;
 }
 
 void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
@@ -229,52 +502,33 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
-    const auto &eng = getEngine();
-
-    for (auto map_rule : ti->input_port_map) {
-        auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &to_mem = input_mem[map_rule.to];
-
-        if (map_rule.axis == -1)
-            first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+    if (bodies.size() > 1 && !canSplitBatch()) {
+        batch_split = 1;
+        bodies.clear();
+        bodies.emplace_back(new Body());
+        createBody(*bodies.back(), ti->body);
     }
 
-    for (auto map_rule : ti->output_port_map) {
-        auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &from_mem = output_mem[map_rule.to];
-
-        if (map_rule.axis == -1)
-            last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
-    }
+    const int num_bodies = static_cast<int>(bodies.size());
+    const int batch_size = num_bodies > 1 ? static_cast<int>(ti->insData[0].lock()->getDims()[0]) / num_bodies : -1;
+    for (int i = 0; i < num_bodies; i++)
+        createMappers(*bodies[i], *ti, i * batch_size, batch_size);
 
-    for (auto map_rule : ti->back_edges) {
-        auto from_mem = output_mem[map_rule.from];
-        auto to_mem = input_mem[map_rule.to];
-
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-    }
-
-    // special purpose ports
-    constexpr auto key_cur_iter_port = "loop_body_current_iteration_idx";
-    constexpr auto key_cond_port = "loop_body_condition_output_idx";
-    constexpr auto key_trip_count_port = "loop_trip_count_idx";
-    constexpr auto key_init_cond_port = "loop_execution_condition_idx";
+    // checks of Loop special ports, such ports disable batch split, so only the first body is used
+    auto &body = *bodies.front();
+    const auto &eng = getEngine();
 
     auto iter_idx_ports = ti->GetParamAsInts(key_cur_iter_port, {});
     for (auto idx : iter_idx_ports) {
-        auto to_mem = input_mem[idx];
-        before_mappers.emplace_back(new IterCountPortHelper(to_mem, eng));
+        auto to_mem = body.input_mem[idx];
+        body.before_mappers.emplace_back(new IterCountPortHelper(to_mem, eng));
     }
 
     auto condition_port_idx = ti->GetParamAsInt(key_cond_port, -1);
     if (condition_port_idx == -1) {
         continue_cond_check.reset(new staticValueCheck(true)); // always true
     } else {
-        auto mem = output_mem[condition_port_idx];
+        auto mem = body.output_mem[condition_port_idx];
         continue_cond_check.reset(new asBoolCheck(mem));
     }
 
@@ -295,32 +549,118 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     }
 }
 
+void MKLDNNTensorIteratorNode::createMappers(Body &body, const InferenceEngine::TensorIterator &ti,
+                                             int batch_offset, int batch_size) {
+    const auto &eng = getEngine();
+    const bool whole_batch = batch_size == -1;
+    auto batchSliceOf = [&](const MKLDNNMemoryPtr &full_mem) {
+        return BatchSlice {batch_offset, whole_batch ? static_cast<int>(full_mem->GetDims()[0]) : batch_size};
+    };
+
+    for (auto map_rule : ti.input_port_map) {
+        auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+        auto &to_mem = body.input_mem[map_rule.to];
+
+        if (map_rule.axis == -1) {
+            if (whole_batch)
+                body.first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+            else
+                body.first_mappers.emplace_back(new BatchSlicePortHelper(from_mem, to_mem, true, batchSliceOf(from_mem), eng));
+            continue;
+        }
+
+        const auto batch_slice = batchSliceOf(from_mem);
+
+        ChunkLayout chunk(from_mem, map_rule.axis, map_rule.stride, batch_slice);
+        const auto &in_node = body.input_nodes[map_rule.to];
+        if (PortAliasHelper::isApplicable(from_mem, to_mem, chunk) && MKLDNNGraph::IsInputMemoryReplaceable(in_node)) {
+            std::vector<MKLDNNMemoryPtr> part_mems;
+            for (size_t i = 0; i < in_node->getChildEdges().size(); i++)
+                part_mems.push_back(in_node->getChildEdgeAt(i)->getMemoryPtr());
+            body.before_mappers.emplace_back(new PortAliasHelper(from_mem, part_mems, chunk));
+        } else {
+            body.before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, batch_slice, eng));
+        }
+    }
+
+    // Outputs are redirected to the next chunk only after the back edges copied the previous iteration results
+    std::vector<std::shared_ptr<PortMapHelper>> output_aliases;
+    std::set<int> aliased_outputs;
+    for (auto map_rule : ti.output_port_map) {
+        auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
+        auto &from_mem = body.output_mem[map_rule.to];
+
+        if (map_rule.axis == -1) {
+            if (whole_batch)
+                body.last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+            else
+                body.last_mappers.emplace_back(new BatchSlicePortHelper(from_mem, to_mem, false, batchSliceOf(to_mem), eng));
+            continue;
+        }
+
+        const auto batch_slice = batchSliceOf(to_mem);
+
+        ChunkLayout chunk(to_mem, map_rule.axis, map_rule.stride, batch_slice);
+        const auto &out_node = body.output_nodes[map_rule.to];
+        // body input passed directly to the output can't be redirected to both TI input and output
+        const bool from_body_input = out_node->getParentEdgeAt(0)->getParent()->getType() == Input;
+        if (PortAliasHelper::isApplicable(to_mem, from_mem, chunk) && !from_body_input &&
+            aliased_outputs.insert(map_rule.to).second && MKLDNNGraph::IsOutputMemoryReplaceable(out_node)) {
+            output_aliases.emplace_back(new PortAliasHelper(to_mem, {from_mem}, chunk));
+        } else {
+            body.after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, batch_slice, eng));
+        }
+    }
+
+    for (auto map_rule : ti.back_edges) {
+        auto from_mem = body.output_mem[map_rule.from];
+        auto to_mem = body.input_mem[map_rule.to];
+
+        body.before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+    }
+
+    body.before_mappers.insert(body.before_mappers.end(), output_aliases.begin(), output_aliases.end());
+}
+
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
-    sub_graph.ResetInferCount();
+    if (bodies.size() == 1) {
+        executeBody(*bodies.front(), strm);
+        return;
+    }
+
+    // batch sub-slices are independent, every body uses its own stream
+    parallel_for(bodies.size(), [&](size_t i) {
+        mkldnn::stream body_strm(getEngine());
+        executeBody(*bodies[i], body_strm);
+    });
+}
+
+void MKLDNNTensorIteratorNode::executeBody(Body &body, mkldnn::stream strm) {
+    body.graph.ResetInferCount();
 
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
 
-    for (auto &mapper : first_mappers)
+    for (auto &mapper : body.first_mappers)
         mapper->execute(strm);
 
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
-        for (auto &mapper : before_mappers)
+        for (auto &mapper : body.before_mappers)
             mapper->execute(strm, i);
 
-        sub_graph.Infer();
+        body.graph.Infer();
 
         continue_cond = continue_cond_check->getStatus();
 
         // copy data from subgraph iteration to outputs
         // or to next iteration inputs
-        for (auto &mapper : after_mappers)
+        for (auto &mapper : body.after_mappers)
             mapper->execute(strm, i);
     }
 
-    for (auto &mapper : last_mappers)
+    for (auto &mapper : body.last_mappers)
         mapper->execute(strm);
 }
 
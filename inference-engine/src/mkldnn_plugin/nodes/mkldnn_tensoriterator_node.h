@@ -57,17 +57,36 @@ public:
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 
 private:
+    /**
+     * Body graph with the port mappers bound to its memory. TI is executed either by a single body
+     * or by several bodies processing independent batch sub-slices of the TI tensors concurrently.
+     */
+    struct Body {
+        MKLDNNGraph graph;
+        std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
+        std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+
+        std::vector<std::shared_ptr<PortMapHelper>>
+            first_mappers,   /// < Applied once before loop
+            last_mappers,    /// < Applied once after loop
+            before_mappers,  /// < Applied before each iteration
+            after_mappers;   /// < Applied after each iteration
+    };
+
+    void createBody(Body &body, const InferenceEngine::TensorIterator::Body &net);
+    void createMappers(Body &body, const InferenceEngine::TensorIterator &ti, int batch_offset, int batch_size);
+    void executeBody(Body &body, mkldnn::stream strm);
+
+    // Number of batch sub-slices which can be processed independently, 1 if the body may mix batch elements
+    int getBatchSplit(const InferenceEngine::TensorIterator &ti) const;
+    // Batch sub-slices are used only if all the TI tensors have plain layout
+    bool canSplitBatch() const;
+
     int n_iter = 0;
+    int batch_split = 1;
 
     MKLDNNExtensionManager::Ptr ext_mng;
-    MKLDNNGraph sub_graph;
-    std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
-
-    std::vector<std::shared_ptr<PortMapHelper>>
-        first_mappers,   /// < Applied once before loop
-        last_mappers,    /// < Applied once after loop
-        before_mappers,  /// < Applied before each iteration
-        after_mappers;   /// < Applied after each iteration
+    std::vector<std::unique_ptr<Body>> bodies;
 
     std::shared_ptr<PortChecker>
         trip_count_check,      /// < Perform check of trip count value. value >= -1
@@ -6,6 +6,8 @@
 
 #include <chrono>
 
+#include "utils/hw_perf_counters.h"
+
 namespace MKLDNNPlugin {
 
 class PerfCount {
@@ -15,11 +17,32 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    HwPerfCounters::Values hwTotal;
+    uint32_t hwNum = 0;
+
 public:
     PerfCount(): duration(0), num(0) {}
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    void addHwValues(const HwPerfCounters::Values& values) {
+        hwTotal += values;
+        hwNum++;
+    }
+
+    bool hasHwValues() const { return hwNum != 0; }
+
+    HwPerfCounters::Values hwAvg() const {
+        HwPerfCounters::Values values;
+        if (hwNum == 0)
+            return values;
+        values.cycles = hwTotal.cycles / hwNum;
+        values.instructions = hwTotal.instructions / hwNum;
+        values.cacheMisses = hwTotal.cacheMisses / hwNum;
+        values.taskClockNs = hwTotal.taskClockNs / hwNum;
+        return values;
+    }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
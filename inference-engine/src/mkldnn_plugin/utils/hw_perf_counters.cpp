@@ -0,0 +1,179 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_perf_counters.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+HwPerfCounters::Values& HwPerfCounters::Values::operator+=(const Values& other) {
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cacheMisses += other.cacheMisses;
+    taskClockNs += other.taskClockNs;
+    return *this;
+}
+
+HwPerfCounters::Values HwPerfCounters::Values::operator-(const Values& other) const {
+    // counters of the exited threads are dropped, so the difference is clamped instead of wrapping around
+    auto sub = [](uint64_t a, uint64_t b) { return a > b ? a - b : 0; };
+    Values result;
+    result.cycles = sub(cycles, other.cycles);
+    result.instructions = sub(instructions, other.instructions);
+    result.cacheMisses = sub(cacheMisses, other.cacheMisses);
+    result.taskClockNs = sub(taskClockNs, other.taskClockNs);
+    return result;
+}
+
+#ifdef __linux__
+
+namespace {
+
+int openCounter(uint32_t type, uint64_t config, pid_t tid, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING | PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, groupFd, 0));
+}
+
+}  // namespace
+
+struct HwPerfCounters::ThreadCounters {
+    pid_t tid = 0;
+    // the counters of the thread are scheduled together and read by a single call of the group leader
+    std::vector<int> fds;
+    std::vector<uint64_t Values::*> fields;     // the values of the group members in the read order
+
+    ~ThreadCounters() {
+        for (auto fd = fds.rbegin(); fd != fds.rend(); ++fd)
+            close(*fd);
+    }
+
+    bool add(uint32_t type, uint64_t config, uint64_t Values::* field) {
+        const int fd = openCounter(type, config, tid, fds.empty() ? -1 : fds.front());
+        if (fd < 0)
+            return false;
+        fds.push_back(fd);
+        fields.push_back(field);
+        return true;
+    }
+
+    bool open(bool withHardwareEvents) {
+        if (withHardwareEvents && add(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, &Values::cycles)) {
+            add(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, &Values::instructions);
+            add(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, &Values::cacheMisses);
+        }
+        return add(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, &Values::taskClockNs);
+    }
+
+    bool withHardwareEvents() const {
+        return fields.front() == &Values::cycles;
+    }
+
+    void read(Values& values) const {
+        // scales the value to the whole enabled time if the counters were multiplexed
+        auto scaled = [](uint64_t value, uint64_t enabled, uint64_t running) {
+            return running == 0 ? 0 : (running == enabled ? value :
+                static_cast<uint64_t>(static_cast<double>(value) * enabled / running));
+        };
+
+        // nr, time_enabled, time_running, values of the members
+        uint64_t group[3 + 4] = {};
+        const auto size = ::read(fds.front(), group, sizeof(group));
+        if (size < static_cast<ssize_t>(3 * sizeof(uint64_t)))
+            return;
+        const size_t count = std::min<size_t>({group[0], fields.size(), size / sizeof(uint64_t) - 3});
+        for (size_t index = 0; index < count; ++index)
+            values.*fields[index] += scaled(group[3 + index], group[1], group[2]);
+    }
+};
+
+HwPerfCounters::HwPerfCounters() {
+    std::unique_ptr<ThreadCounters> probe(new ThreadCounters());
+    probe->tid = static_cast<pid_t>(syscall(SYS_gettid));
+    available = probe->open(true);
+    withHardwareEvents = available && probe->withHardwareEvents();
+    if (available)
+        threads.push_back(std::move(probe));
+}
+
+HwPerfCounters::~HwPerfCounters() = default;
+
+constexpr std::chrono::milliseconds HwPerfCounters::rescanInterval;
+
+void HwPerfCounters::trackThreads() {
+    if (!available)
+        return;
+
+    std::lock_guard<std::mutex> lock{mutex};
+    // the directory listing is much slower than the inference of small networks
+    const auto now = std::chrono::steady_clock::now();
+    if (lastScan != std::chrono::steady_clock::time_point{} && now - lastScan < rescanInterval)
+        return;
+    lastScan = now;
+
+    std::vector<pid_t> tids;
+    if (DIR* dir = opendir("/proc/self/task")) {
+        while (dirent* entry = readdir(dir)) {
+            if (entry->d_name[0] != '.')
+                tids.push_back(static_cast<pid_t>(std::strtol(entry->d_name, nullptr, 10)));
+        }
+        closedir(dir);
+    }
+    std::sort(tids.begin(), tids.end());
+
+    // exited threads are dropped, the counters of the new ones are opened
+    threads.erase(std::remove_if(threads.begin(), threads.end(), [&](const std::unique_ptr<ThreadCounters>& thread) {
+        return !std::binary_search(tids.begin(), tids.end(), thread->tid);
+    }), threads.end());
+    for (pid_t tid : tids) {
+        if (std::any_of(threads.begin(), threads.end(), [&](const std::unique_ptr<ThreadCounters>& thread) { return thread->tid == tid; }))
+            continue;
+        std::unique_ptr<ThreadCounters> thread(new ThreadCounters());
+        thread->tid = tid;
+        if (thread->open(withHardwareEvents))
+            threads.push_back(std::move(thread));
+    }
+}
+
+HwPerfCounters::Values HwPerfCounters::read() const {
+    Values values;
+    std::lock_guard<std::mutex> lock{mutex};
+    for (const auto& thread : threads)
+        thread->read(values);
+    return values;
+}
+
+#else
+
+struct HwPerfCounters::ThreadCounters {};
+
+HwPerfCounters::HwPerfCounters() = default;
+
+HwPerfCounters::~HwPerfCounters() = default;
+
+void HwPerfCounters::trackThreads() {}
+
+HwPerfCounters::Values HwPerfCounters::read() const {
+    return {};
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
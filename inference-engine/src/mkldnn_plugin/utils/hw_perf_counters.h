@@ -0,0 +1,70 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Hardware performance counters of the whole process (Linux perf_event).
+ * The counters are opened for every thread of the process, so the work of the parallel regions is counted too,
+ * but other activity of the process (e.g. other streams) is counted as well, so the plugin uses a single stream
+ * with the counters. The counters of a thread are one perf_event group, read() makes one syscall per thread.
+ * Every tracked thread holds several file descriptors, so one instance is shared by all the graphs of a network.
+ * The methods are thread safe.
+ */
+class HwPerfCounters {
+public:
+    struct Values {
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t cacheMisses = 0;   // last level cache misses
+        uint64_t taskClockNs = 0;   // CPU time summed over the threads
+
+        Values& operator+=(const Values& other);
+        Values operator-(const Values& other) const;
+    };
+
+    HwPerfCounters();
+    ~HwPerfCounters();
+
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+
+    /**
+     * @brief Returns false if the counters can't be opened: not a Linux system or access is restricted by perf_event_paranoid
+     */
+    bool isAvailable() const { return available; }
+
+    /**
+     * @brief Opens the counters for the threads of the process which are not tracked yet.
+     * Worker threads are created lazily, so it should be called before each measured run.
+     * The list of the threads is read at most once per rescanInterval, the calls in between are no-op.
+     */
+    void trackThreads();
+
+    /**
+     * @brief Returns the counters summed over the tracked threads, scaled if the counters were multiplexed
+     */
+    Values read() const;
+
+private:
+    struct ThreadCounters;
+
+    static constexpr std::chrono::milliseconds rescanInterval{1000};
+
+    bool available = false;
+    bool withHardwareEvents = true;
+    mutable std::mutex mutex;
+    std::chrono::steady_clock::time_point lastScan;
+    std::vector<std::unique_ptr<ThreadCounters>> threads;
+};
+
+}  // namespace MKLDNNPlugin
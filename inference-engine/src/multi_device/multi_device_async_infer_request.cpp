@@ -32,6 +32,39 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
     };
+    // collects the request to the batch, the task is called when the whole batch is inferred
+    struct ThisRequestBatchExecutor : public ITaskExecutor {
+        explicit ThisRequestBatchExecutor(MultiDeviceAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            auto _this_ = _this;
+            _this->_multiDeviceExecutableNetwork->ScheduleToBatch(_this->_inferRequest.get(), [_this_, task] {
+                _this_->_workerInferRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
+                task();
+            });
+        };
+        MultiDeviceAsyncInferRequest* _this = nullptr;
+    };
+    auto checkStatus = [this] {
+        auto status = _workerInferRequest->_status;
+        if (InferenceEngine::StatusCode::OK != status) {
+            if (nullptr != InferenceEngine::CurrentException())
+                std::rethrow_exception(InferenceEngine::CurrentException());
+            else
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+        }
+        if (_needPerfCounters)
+            _perfMap = _workerInferRequest->_inferRequest.GetPerformanceCounts();
+    };
+    if (_multiDeviceExecutableNetwork->_batchSize > 1) {
+        _pipeline = {
+            // the data is copied to the batch, so the blobs must fit the batch element
+            { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+                _multiDeviceExecutableNetwork->CheckBatchedBlobs(*_inferRequest);
+            }},
+            { /*TaskExecutor*/ std::make_shared<ThisRequestBatchExecutor>(this), /*task*/ checkStatus}
+        };
+        return;
+    }
     _pipeline = {
         // if the request is coming with device-specific remote blobs make sure it is scheduled to the specific device only:
         { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
@@ -68,17 +101,7 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
                _inferRequest->SetBlobsToAnotherRequest(_workerInferRequest->_inferRequest);
         }},
         // final task in the pipeline:
-        { /*TaskExecutor*/std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
-              auto status = _workerInferRequest->_status;
-              if (InferenceEngine::StatusCode::OK != status) {
-                  if (nullptr != InferenceEngine::CurrentException())
-                      std::rethrow_exception(InferenceEngine::CurrentException());
-                  else
-                      THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
-              }
-              if (_needPerfCounters)
-                  _perfMap = _workerInferRequest->_inferRequest.GetPerformanceCounts();
-        }}
+        { /*TaskExecutor*/std::make_shared<ThisRequestExecutor>(this), /*task*/ checkStatus}
     };
 }
 
@@ -3,6 +3,10 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -16,9 +20,12 @@
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
 #include <multi-device/multi_device_config.hpp>
 #include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
 #include "multi_device_exec_network.hpp"
 #include "multi_device_async_infer_request.hpp"
+#include "multi_device_infer_request.hpp"
 #include "multi_device_plugin.hpp"
+#include "multi_device_scheduling.hpp"
 
 // ------------------------------MultiDeviceExecutableNetwork----------------------------
 namespace MultiDevicePlugin {
@@ -48,22 +55,37 @@ struct IdleGuard {
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests*  _notBusyWorkerRequests = nullptr;
 };
 
+namespace {
+void CopyBytes(const Blob::Ptr& src, std::size_t srcOffset, const Blob::Ptr& dst, std::size_t dstOffset, std::size_t size) {
+    auto srcMemory = as<MemoryBlob>(src)->rmap();
+    auto dstMemory = as<MemoryBlob>(dst)->wmap();
+    std::memcpy(dstMemory.as<std::uint8_t*>() + dstOffset, srcMemory.as<const std::uint8_t*>() + srcOffset, size);
+}
+}  // namespace
+
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
-                                                           const bool                                                           needPerfCounters) :
+                                                           const bool                                                           needPerfCounters,
+                                                           const std::size_t                                                    batchSize,
+                                                           const std::chrono::milliseconds                                      batchTimeout,
+                                                           const SchedulingPolicy                                               schedulingPolicy) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
-    _devicePriorities{networkDevices},
+    _devicePriorities{std::make_shared<const std::vector<DeviceInformation>>(networkDevices)},
     _devicePrioritiesInitial{networkDevices},
     _networksPerDevice{networksPerDevice},
+    _schedulingPolicy{schedulingPolicy},
+    _creationTime{std::chrono::steady_clock::now()},
     _config{config},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _batchSize{batchSize},
+    _batchTimeout{batchTimeout} {
     _taskExecutor.reset();
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
 
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
+        auto itNumRequests = std::find_if(_devicePrioritiesInitial.cbegin(), _devicePrioritiesInitial.cend(),
                 [&device](const DeviceInformation& d){ return d.deviceName == device;});
         unsigned int optimalNum = 0;
         try {
@@ -74,11 +96,12 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
                     << "Failed to query the metric for the " << device << " with error:" << iie.what();
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
+        const auto numRequests = (_devicePrioritiesInitial.end() == itNumRequests ||
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
+        _deviceStatistics[device]._numRequests = numRequests;
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
@@ -90,31 +113,114 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                 [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    OnWorkerCompleted(workerRequestPtr, device);
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
                     }
                     // try to return the request to the idle list (fails if the overall object destruction has began)
                     if (idleGuard.Release()->try_push(workerRequestPtr)) {
+                        // the batches collected while all the requests were busy can be started now
+                        if (_batchSize > 1) {
+                            ScheduleBatches();
+                            // the timer waits for a completed request when the expired batch can't be started,
+                            // so it is woken up to track the deadline of the requests left in the queue
+                            std::lock_guard<std::mutex> lock{_batchMutex};
+                            _batchCondVar.notify_one();
+                            return;
+                        }
                         // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                         // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                         Task t;
                         if (_inferPipelineTasks.try_pop(t))
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                            _deviceStatistics.at(device)._waiting--;
                             ScheduleToWorkerInferRequest(std::move(t), device);
+                        }
                     }
                 });
         }
     }
+
+    if (_batchSize > 1) {
+        // all the devices infer the same reshaped network, so any of them can be used to get the size of the batch element
+        auto& network = _networksPerDevice.begin()->second;
+        auto& request = _workerRequests.begin()->second.front()._inferRequest;
+        for (auto&& input : network.GetInputsInfo())
+            _batchElementByteSizes[input.first] = request.GetBlob(input.first)->byteSize() / _batchSize;
+        for (auto&& output : network.GetOutputsInfo())
+            _batchElementByteSizes[output.first] = request.GetBlob(output.first)->byteSize() / _batchSize;
+
+        // starts partially filled batches when the oldest request in the batch has waited for the timeout
+        _batchTimer = std::thread{[this] {
+            std::unique_lock<std::mutex> lock{_batchMutex};
+            while (!_stopBatching) {
+                if (_batchedTasks.empty()) {
+                    _batchCondVar.wait(lock);
+                    continue;
+                }
+                auto deadline = _batchedTasks.front()._deadline;
+                if (std::chrono::steady_clock::now() < deadline) {
+                    _batchCondVar.wait_until(lock, deadline);
+                    continue;
+                }
+                lock.unlock();
+                ScheduleBatches();
+                lock.lock();
+                // no idle worker requests, so the batch is started by the first completed worker request
+                if (!_stopBatching && !_batchedTasks.empty() && std::chrono::steady_clock::now() >= _batchedTasks.front()._deadline)
+                    _batchCondVar.wait(lock);
+            }
+        }};
+    }
 }
 
-void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+std::shared_ptr<const std::vector<DeviceInformation>> MultiDeviceExecutableNetwork::GetDevicePriorities() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _devicePriorities;
+}
+
+void MultiDeviceExecutableNetwork::OnWorkerStarted(WorkerInferRequest* workerRequestPtr, const DeviceName& device) {
+    workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+    _deviceStatistics.at(device)._inFlight++;
+}
+
+void MultiDeviceExecutableNetwork::OnWorkerCompleted(WorkerInferRequest* workerRequestPtr, const DeviceName& device) {
+    auto& statistics = _deviceStatistics.at(device);
+    const std::uint64_t latency = std::max<std::int64_t>(1, std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count());
+    // exponential moving average with the weight of the new sample of 1/8
+    auto average = statistics._latencyUs.load();
+    std::uint64_t updated = 0;
+    do {
+        updated = average == 0 ? latency : average - average / 8 + latency / 8;
+    } while (!statistics._latencyUs.compare_exchange_weak(average, updated));
+    statistics._completed++;
+    statistics._inFlight--;
+}
+
+DeviceName MultiDeviceExecutableNetwork::SelectDevice(const std::vector<DeviceInformation>& devices) const {
+    std::vector<DeviceLoad> loads;
+    loads.reserve(devices.size());
     for (auto&& device : devices) {
+        auto& statistics = _deviceStatistics.at(device.deviceName);
+        DeviceLoad load;
+        load.numRequests = statistics._numRequests;
+        load.pending = statistics._inFlight.load() + statistics._waiting.load();
+        load.latencyUs = statistics._latencyUs.load();
+        loads.push_back(load);
+    }
+    const auto selected = SelectDeviceByLatency(loads);
+    return selected < devices.size() ? devices[selected].deviceName : DeviceName{};
+}
+
+void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
+    auto devices = GetDevicePriorities();
+    if (SchedulingPolicy::Latency == _schedulingPolicy && preferred_device.empty()) {
+        preferred_device = SelectDevice(*devices);
+    }
+    for (auto&& device : *devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
         WorkerInferRequest* workerRequestPtr = nullptr;
@@ -122,6 +228,7 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
+            OnWorkerStarted(workerRequestPtr, device.deviceName);
             {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
@@ -131,10 +238,127 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
+        _deviceStatistics.at(preferred_device)._waiting++;
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
+}
+
+void MultiDeviceExecutableNetwork::CheckBatchedBlobs(MultiDeviceInferRequest& inferRequest) const {
+    auto checkBlob = [&](const std::string& name, const TensorDesc& networkDesc) {
+        // this request is already in BUSY state, so using the internal functions safely
+        auto blob = inferRequest.GetBlob(name);
+        if (nullptr == blob->as<MemoryBlob>() || blob->is<RemoteBlob>()) {
+            THROW_IE_EXCEPTION << "MULTI device batching supports only memory blobs, while the blob '" << name << "' is not";
+        }
+        // the data is copied to the batch element as is, so the strides, the padding and the layout must match as well
+        const auto& desc = blob->getTensorDesc();
+        if (desc != networkDesc) {
+            THROW_IE_EXCEPTION << "MULTI device batching expects the blob '" << name << "' of the network tensor description ("
+                               << networkDesc.getPrecision() << ", " << networkDesc.getLayout() << ", dense), while the blob is "
+                               << desc.getPrecision() << ", " << desc.getLayout()
+                               << (desc.getBlockingDesc() == BlockingDesc(desc.getDims(), desc.getLayout()) ? "" : ", not dense");
+        }
+    };
+    for (auto&& input : _networkInputs)
+        checkBlob(input.first, input.second->getTensorDesc());
+    for (auto&& output : _networkOutputs)
+        checkBlob(output.first, output.second->getTensorDesc());
+}
+
+void MultiDeviceExecutableNetwork::ScheduleToBatch(MultiDeviceInferRequest* inferRequest, Task task) {
+    bool batchIsCollected = false;
+    {
+        std::lock_guard<std::mutex> lock{_batchMutex};
+        _batchedTasks.push_back({inferRequest, std::move(task), std::chrono::steady_clock::now() + _batchTimeout});
+        // only the oldest request defines when the timer has to start the batch
+        if (_batchedTasks.size() == 1)
+            _batchCondVar.notify_one();
+        batchIsCollected = _batchedTasks.size() >= _batchSize;
+    }
+    if (batchIsCollected)
+        ScheduleBatches();
+}
+
+void MultiDeviceExecutableNetwork::ScheduleBatches() {
+    auto devices = GetDevicePriorities();
+    while (true) {
+        WorkerInferRequest* workerRequestPtr = nullptr;
+        NotBusyWorkerRequests* idleWorkerRequestsPtr = nullptr;
+        DeviceName deviceName;
+        std::vector<BatchedTask> batch;
+        {
+            std::lock_guard<std::mutex> lock{_batchMutex};
+            if (_batchedTasks.empty() ||
+                (_batchedTasks.size() < _batchSize && std::chrono::steady_clock::now() < _batchedTasks.front()._deadline)) {
+                return;
+            }
+            for (auto&& device : *devices) {
+                idleWorkerRequestsPtr = &_idleWorkerRequests[device.deviceName];
+                if (idleWorkerRequestsPtr->try_pop(workerRequestPtr)) {
+                    deviceName = device.deviceName;
+                    OnWorkerStarted(workerRequestPtr, deviceName);
+                    break;
+                }
+            }
+            if (nullptr == workerRequestPtr)
+                return;
+            auto batchEnd = _batchedTasks.begin() + std::min(_batchSize, _batchedTasks.size());
+            batch.assign(std::make_move_iterator(_batchedTasks.begin()), std::make_move_iterator(batchEnd));
+            _batchedTasks.erase(_batchedTasks.begin(), batchEnd);
+        }
+        StartBatch(workerRequestPtr, deviceName, *idleWorkerRequestsPtr, std::move(batch));
+    }
+}
+
+void MultiDeviceExecutableNetwork::StartBatch(WorkerInferRequest* workerRequestPtr,
+                                              const DeviceName& device,
+                                              NotBusyWorkerRequests& idleWorkerRequests,
+                                              std::vector<BatchedTask> batch) {
+    IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+    auto batchPtr = std::make_shared<std::vector<BatchedTask>>(std::move(batch));
+    try {
+        for (std::size_t i = 0; i < batchPtr->size(); i++) {
+            for (auto&& input : _networkInputs) {
+                auto size = _batchElementByteSizes.at(input.first);
+                CopyBytes((*batchPtr)[i]._inferRequest->GetBlob(input.first), 0,
+                          workerRequestPtr->_inferRequest.GetBlob(input.first), i * size, size);
+            }
+        }
+        workerRequestPtr->_task = [this, workerRequestPtr, batchPtr] {
+            auto& batch = *batchPtr;
+            _thisWorkerInferRequest = workerRequestPtr;
+            if (StatusCode::OK == workerRequestPtr->_status) {
+                for (std::size_t i = 0; i < batch.size(); i++) {
+                    for (auto&& output : _networkOutputs) {
+                        auto size = _batchElementByteSizes.at(output.first);
+                        CopyBytes(workerRequestPtr->_inferRequest.GetBlob(output.first), i * size,
+                                  batch[i]._inferRequest->GetBlob(output.first), 0, size);
+                    }
+                }
+            }
+            for (auto&& batchedTask : batch)
+                batchedTask._task();
+        };
+        workerRequestPtr->_inferRequest.StartAsync();
+    } catch (...) {
+        // the worker request is not started, so it is completed here to keep the device statistics balanced
+        auto error = std::current_exception();
+        workerRequestPtr->_task = {};
+        OnWorkerCompleted(workerRequestPtr, device);
+        workerRequestPtr->_status = StatusCode::GENERAL_ERROR;
+        _thisWorkerInferRequest = workerRequestPtr;
+        // every request of the batch rethrows the original exception, the same as for a failed inference
+        for (auto&& batchedTask : *batchPtr) {
+            InferenceEngine::CurrentException() = error;
+            batchedTask._task();
+        }
+        InferenceEngine::CurrentException() = nullptr;
+        return;
+    }
+    idleGuard.Release();
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -142,9 +366,17 @@ void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
+    if (_batchTimer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{_batchMutex};
+            _stopBatching = true;
+        }
+        _batchCondVar.notify_one();
+        _batchTimer.join();
+    }
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        _devicePriorities.clear();
+        _devicePriorities = std::make_shared<const std::vector<DeviceInformation>>();
     }
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` worker infer requests' threads.
      *       But AsyncInferRequest destructor should wait for all asynchronous tasks by the request
@@ -157,13 +389,10 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
 }
 
 RemoteContext::Ptr MultiDeviceExecutableNetwork::GetContext() const {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+    auto devices = GetDevicePriorities();
 
     std::string devices_names;
-    for (auto&& device : devices) {
+    for (auto&& device : *devices) {
         devices_names += device.deviceName + " ";
         const auto& n  = _networksPerDevice.at(device.deviceName);
         try {
@@ -182,7 +411,10 @@ InferenceEngine::InferRequestInternal::Ptr MultiDeviceExecutableNetwork::CreateI
     InferenceEngine::InferRequest request_to_share_blobs_with;
     // borrowing device-specific blobs from the underlying requests for the device-agnostic, user-facing requests
     // this allows to potentially save on the data-copy later (if the requests are scheduled in the same order)
+    // the batched requests have blobs of other shapes, so the data is always copied
     for (const auto& device : _devicePrioritiesInitial) {
+        if (_batchSize > 1)
+            break;
         auto& dev_requests = _workerRequests[device.deviceName];
         if ((num - sum) < dev_requests.size()) {
             request_to_share_blobs_with = dev_requests.at(num - sum)._inferRequest;
@@ -232,7 +464,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                             " device was not in the original device list!";
                 }
             }
-            _devicePriorities = metaDevices;
+            _devicePriorities = std::make_shared<const std::vector<DeviceInformation>>(metaDevices);
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -254,7 +486,8 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         unsigned int res = 0u;
         for (auto n : _networksPerDevice) {
             try {
-                res += n.second.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+                // every worker request needs the whole batch of user requests
+                res += n.second.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>() * _batchSize;
             } catch (const InferenceEngine::details::InferenceEngineException &iie) {
                   THROW_IE_EXCEPTION
                         << "Every device used with the Multi-Device should "
@@ -273,11 +506,28 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(DEVICE_SCHEDULING_STATISTICS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_BATCH_SIZE,
+                                                MultiDeviceConfigParams::KEY_MULTI_BATCH_TIMEOUT,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == METRIC_KEY(DEVICE_SCHEDULING_STATISTICS)) {
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _creationTime).count();
+        std::map<std::string, std::map<std::string, double>> statistics;
+        for (auto&& deviceStatistics : _deviceStatistics) {
+            auto& value = deviceStatistics.second;
+            const auto completed = static_cast<double>(value._completed.load());
+            statistics[deviceStatistics.first] = {
+                {"LATENCY_MS", value._latencyUs.load() / 1000.0},
+                {"THROUGHPUT_FPS", seconds > 0 ? completed * _batchSize / seconds : 0.0},
+                {"COMPLETED_REQUESTS", completed},
+                {"REQUESTS_IN_FLIGHT", static_cast<double>(value._inFlight.load())}};
+        }
+        IE_SET_METRIC_RETURN(DEVICE_SCHEDULING_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
     }
@@ -6,8 +6,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -23,6 +29,8 @@
 
 namespace MultiDevicePlugin {
 
+class MultiDeviceInferRequest;
+
 using DeviceName = std::string;
 
 struct DeviceInformation {
@@ -31,6 +39,11 @@ struct DeviceInformation {
     int numRequestsPerDevices;
 };
 
+enum class SchedulingPolicy {
+    Priority,
+    Latency
+};
+
 template<typename T>
 using DeviceMap = std::unordered_map<DeviceName, T>;
 
@@ -102,13 +115,30 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
+    };
+    struct DeviceStatistics {
+        std::size_t                 _numRequests = 0;
+        std::atomic<std::uint64_t>  _latencyUs = {0};  // moving average, 0 until the first request is completed
+        std::atomic<std::uint64_t>  _completed = {0};
+        std::atomic<std::uint64_t>  _inFlight = {0};
+        std::atomic<std::uint64_t>  _waiting = {0};  // tasks in the device specific queue
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
+    // user request waiting for the batch to be collected, the task is called after the batch inference is completed
+    struct BatchedTask {
+        MultiDeviceInferRequest*                _inferRequest;
+        InferenceEngine::Task                   _task;
+        std::chrono::steady_clock::time_point   _deadline;
+    };
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
                                           const std::unordered_map<std::string, InferenceEngine::Parameter>&    config,
-                                          const bool                                                            needPerfCounters = false);
+                                          const bool                                                            needPerfCounters = false,
+                                          const std::size_t                                                     batchSize = 1,
+                                          const std::chrono::milliseconds                                       batchTimeout = {},
+                                          const SchedulingPolicy                                                schedulingPolicy = SchedulingPolicy::Priority);
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
@@ -121,6 +151,15 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    // the device with the lowest expected completion time of a new request, empty if none of the devices can be selected
+    DeviceName SelectDevice(const std::vector<DeviceInformation>& devices) const;
+    std::shared_ptr<const std::vector<DeviceInformation>> GetDevicePriorities() const;
+    // batching mode: the task is called once the request data is inferred as a part of the batch
+    void ScheduleToBatch(MultiDeviceInferRequest* inferRequest, InferenceEngine::Task task);
+    // starts the collected batches on idle worker requests, partially filled batches are started after the timeout only
+    void ScheduleBatches();
+    // checks that the blobs of the user request can be copied to a single batch element of the worker requests
+    void CheckBatchedBlobs(MultiDeviceInferRequest& inferRequest) const;
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -128,16 +167,33 @@ public:
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81880
     static thread_local const char*                             _thisPreferredDeviceName;
     mutable std::mutex                                          _mutex;
-    std::vector<DeviceInformation>                              _devicePriorities;
+    std::shared_ptr<const std::vector<DeviceInformation>>       _devicePriorities;
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    const SchedulingPolicy                                      _schedulingPolicy = SchedulingPolicy::Priority;
+    const std::chrono::steady_clock::time_point                 _creationTime;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    const std::size_t                                           _batchSize = 1;
+    const std::chrono::milliseconds                             _batchTimeout;
+    std::unordered_map<std::string, std::size_t>                _batchElementByteSizes;
+    std::mutex                                                  _batchMutex;
+    std::condition_variable                                     _batchCondVar;
+    std::deque<BatchedTask>                                     _batchedTasks;
+    bool                                                        _stopBatching = false;
+    std::thread                                                 _batchTimer;
+
+private:
+    void OnWorkerStarted(WorkerInferRequest* workerRequestPtr, const DeviceName& device);
+    void OnWorkerCompleted(WorkerInferRequest* workerRequestPtr, const DeviceName& device);
+    void StartBatch(WorkerInferRequest* workerRequestPtr, const DeviceName& device, NotBusyWorkerRequests& idleWorkerRequests,
+                    std::vector<BatchedTask> batch);
 };
 
 }  // namespace MultiDevicePlugin
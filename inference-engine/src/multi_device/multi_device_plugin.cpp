@@ -12,6 +12,7 @@
 
 
 #include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
 #include <multi-device/multi_device_config.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include "multi_device_plugin.hpp"
@@ -27,6 +28,45 @@ namespace {
         }
         return config;
     }
+
+    int parseNonNegativeNumber(const std::map<std::string, std::string>& config, const std::string& key, int defaultValue) {
+        auto it = config.find(key);
+        if (it == config.end()) {
+            return defaultValue;
+        }
+        int value = -1;
+        try {
+            value = std::stoi(it->second);
+        } catch (...) {
+        }
+        if (value < 0) {
+            THROW_IE_EXCEPTION << "Wrong value " << it->second << " for the " << key << " config key";
+        }
+        return value;
+    }
+
+    CNNNetwork reshapeToBatch(const CNNNetwork& network, std::size_t batchSize) {
+        auto batchedNetwork = InferenceEngine::details::cloneNetwork(network);
+        auto shapes = batchedNetwork.getInputShapes();
+        for (auto&& shape : shapes) {
+            if (shape.second.empty() || shape.second[0] != 1) {
+                THROW_IE_EXCEPTION << "MULTI device batching requires the batch of 1 in the outer dimension of the network inputs, "
+                                   << "while the input '" << shape.first << "' doesn't have it";
+            }
+            shape.second[0] = batchSize;
+        }
+        batchedNetwork.reshape(shapes);
+        auto outputs = network.getOutputsInfo();
+        for (auto&& output : batchedNetwork.getOutputsInfo()) {
+            const auto& dims = output.second->getTensorDesc().getDims();
+            const auto& originalDims = outputs.at(output.first)->getTensorDesc().getDims();
+            if (dims.empty() || dims[0] != batchSize || originalDims[0] != 1) {
+                THROW_IE_EXCEPTION << "MULTI device batching requires the batch of 1 in the outer dimension of the network outputs, "
+                                   << "while the output '" << output.first << "' doesn't have it";
+            }
+        }
+        return batchedNetwork;
+    }
 }  // namespace
 
 std::map<std::string, std::string> MultiDeviceInferencePlugin::GetSupportedConfig(
@@ -109,6 +149,12 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(BATCH_SIZE) || name == MULTI_CONFIG_KEY(BATCH_TIMEOUT)) {
+        auto it = _config.find(name);
+        return { it == _config.end() ? std::string{"1"} : it->second };
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(name);
+        return { it == _config.end() ? std::string{MULTI_CONFIG_VALUE(SCHEDULE_BY_PRIORITY)} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -141,6 +187,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_BATCH_SIZE,
+            MultiDeviceConfigParams::KEY_MULTI_BATCH_TIMEOUT,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -166,9 +215,30 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
 
     auto metaDevices = ParseMetaDevices(priorities->second, fullConfig);
 
+    const auto batchSize = parseNonNegativeNumber(fullConfig, MultiDeviceConfigParams::KEY_MULTI_BATCH_SIZE, 1);
+    const auto batchTimeout = parseNonNegativeNumber(fullConfig, MultiDeviceConfigParams::KEY_MULTI_BATCH_TIMEOUT, 1);
+    if (batchSize == 0) {
+        THROW_IE_EXCEPTION << "Value for KEY_MULTI_BATCH_SIZE must be > 0";
+    }
+    auto schedulingPolicy = SchedulingPolicy::Priority;
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end()) {
+        if (policy->second == MULTI_CONFIG_VALUE(SCHEDULE_BY_LATENCY)) {
+            schedulingPolicy = SchedulingPolicy::Latency;
+        } else if (policy->second != MULTI_CONFIG_VALUE(SCHEDULE_BY_PRIORITY)) {
+            THROW_IE_EXCEPTION << "Wrong value " << policy->second << " for the KEY_MULTI_SCHEDULING_POLICY config key";
+        }
+    }
+    // the devices infer the network reshaped to the batch, while the user requests are created for the original network
+    const auto deviceNetwork = batchSize > 1 ? reshapeToBatch(network, batchSize) : network;
+
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_BATCH_SIZE] = std::to_string(batchSize);
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_BATCH_TIMEOUT] = std::to_string(batchTimeout);
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = std::string{
+        SchedulingPolicy::Latency == schedulingPolicy ? MULTI_CONFIG_VALUE(SCHEDULE_BY_LATENCY) : MULTI_CONFIG_VALUE(SCHEDULE_BY_PRIORITY)};
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     std::mutex load_mutex;
@@ -177,7 +247,7 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
         loads.push_back([&]() {
             const auto &deviceName = p.deviceName;
             const auto &deviceConfig = p.config;
-            auto exec_net = GetCore()->LoadNetwork(network, deviceName, deviceConfig);
+            auto exec_net = GetCore()->LoadNetwork(deviceNetwork, deviceName, deviceConfig);
             std::unique_lock<std::mutex> lock{load_mutex};
             executableNetworkPerDevice.insert({deviceName, exec_net});
             multiNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
@@ -208,7 +278,10 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     return std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
                                                           metaDevices,
                                                           multiNetworkConfig,
-                                                          enablePerfCounters);
+                                                          enablePerfCounters,
+                                                          static_cast<std::size_t>(batchSize),
+                                                          std::chrono::milliseconds{batchTimeout},
+                                                          schedulingPolicy);
 }
 
 QueryNetworkResult MultiDeviceInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
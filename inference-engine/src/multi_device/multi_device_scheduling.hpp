@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace MultiDevicePlugin {
+
+// the state of a device seen by the latency scheduling policy
+struct DeviceLoad {
+    std::size_t     numRequests = 0;    // worker requests of the device
+    std::uint64_t   pending = 0;        // requests in flight and waiting in the device specific queue
+    std::uint64_t   latencyUs = 0;      // moving average of the request latency, 0 until the first request is completed
+};
+
+// the index of the device with the lowest expected completion time of a new request, loads.size() if none of the devices
+// can be selected. The loads are listed in the device priority order, so the higher priority wins on equal times
+inline std::size_t SelectDeviceByLatency(const std::vector<DeviceLoad>& loads) {
+    std::size_t selected = loads.size();
+    double minCompletionTime = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i < loads.size(); i++) {
+        const auto& load = loads[i];
+        double completionTime = 0;
+        if (load.latencyUs == 0) {
+            // the device has not completed any request yet, so it is tried while it has idle requests
+            if (load.pending >= load.numRequests)
+                continue;
+        } else {
+            // the new request waits until the requests ahead of it free one of the device requests
+            const auto ahead = load.pending + 1 > load.numRequests ? load.pending + 1 - load.numRequests : 0;
+            completionTime = load.latencyUs * (1.0 + static_cast<double>(ahead) / load.numRequests);
+        }
+        if (completionTime < minCompletionTime) {
+            minCompletionTime = completionTime;
+            selected = i;
+        }
+    }
+    return selected;
+}
+
+}  // namespace MultiDevicePlugin
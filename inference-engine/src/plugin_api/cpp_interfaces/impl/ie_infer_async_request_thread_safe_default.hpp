@@ -12,7 +12,9 @@
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
+#include <ie_tracer.hpp>
 
+#include <cstdint>
 #include <exception>
 #include <future>
 #include <map>
@@ -310,6 +312,10 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
+        _traced = IsTracingEnabled();
+        if (_traced) {
+            TraceAsyncBegin("pipeline", "request", GetTraceRequestId());
+        }
         firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
     }
 
@@ -370,6 +376,11 @@ protected:
     }
 
 private:
+    // The request is traced as an asynchronous event, only one inference of the request can be in flight
+    std::uint64_t GetTraceRequestId() const {
+        return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(this));
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -393,7 +404,10 @@ private:
             try {
                 auto& stageTask = std::get<Stage_e::task>(thisStage);
                 IE_ASSERT(nullptr != stageTask);
-                stageTask();
+                {
+                    TraceScope scope{"pipeline", "stage", GetTraceRequestId()};
+                    stageTask();
+                }
                if (itEndStage != itNextStage) {
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
@@ -411,6 +425,9 @@ private:
             if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
                 auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
                     auto promise = std::move(_promise);
+                    if (_traced) {
+                        TraceAsyncEnd("pipeline", "request", GetTraceRequestId());
+                    }
                     IInferRequest::CompletionCallback callback = nullptr;
                     {
                         std::lock_guard<std::mutex> lock{_mutex};
@@ -449,5 +466,6 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    bool _traced = false;  // tracing is checked once per inference, so the request event is always closed
 };
 }  // namespace InferenceEngine
@@ -32,6 +32,12 @@ namespace PluginConfigInternalParams {
  */
 DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 
+/**
+ * @brief Enables tokenization of elementwise operations into JIT compiled snippets
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(SNIPPETS_MODE);
+
 /**
  * @brief Limit \#threads that are used by CPU Executor Streams to execute `parallel_for` calls
  * @ingroup ie_dev_api_plugin_api
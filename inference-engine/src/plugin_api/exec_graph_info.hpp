@@ -75,6 +75,42 @@ static const char LAYER_TYPE[] = "layerType";
  */
 static const char RUNTIME_PRECISION[] = "runtimePrecision";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of CPU cycles of the executable primitive (hardware counters mode).
+ */
+static const char PERF_CYCLES[] = "perfCycles";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of retired instructions of the executable primitive (hardware counters mode).
+ */
+static const char PERF_INSTRUCTIONS[] = "perfInstructions";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of last level cache misses of the executable primitive (hardware counters mode).
+ */
+static const char PERF_CACHE_MISSES[] = "perfCacheMisses";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average CPU time in microseconds summed over the threads (hardware counters mode).
+ */
+static const char PERF_CPU_TIME[] = "perfCpuTimeMcs";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a number of bytes read by the executable primitive, estimated from the input and weights sizes.
+ */
+static const char PERF_BYTES_READ[] = "perfBytesRead";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a number of bytes written by the executable primitive, estimated from the output sizes.
+ */
+static const char PERF_BYTES_WRITTEN[] = "perfBytesWritten";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief The Execution node which is used to represent node in execution graph.
@@ -0,0 +1,137 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Lightweight timeline tracer writing the Chrome trace format
+ * @file ie_tracer.hpp
+ */
+
+#pragma once
+
+#include "ie_api.h"
+
+#include <cstdint>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Checks whether the timeline tracer records the events
+ * @ingroup    ie_dev_profiling
+ * @return     `True` if tracing is enabled by the IE_TRACE_FILE environment variable or EnableTracing(), `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) IsTracingEnabled();
+
+/**
+ * @brief      Enables the timeline tracer. The events are recorded into per thread ring buffers which keep
+ *             the latest events only, they are written by FlushTrace() and at the process exit.
+ *             The buffers of the exited threads are shrunk to the recorded events, the oldest of them are dropped.
+ * @ingroup    ie_dev_profiling
+ * @param[in]  filePath  The path of the Chrome trace JSON file, it can be opened in chrome://tracing or Perfetto UI
+ */
+INFERENCE_ENGINE_API_CPP(void) EnableTracing(const std::string& filePath);
+
+/**
+ * @brief      Disables the timeline tracer, the recorded events are not written at the process exit anymore.
+ *             FlushTrace() still writes them to the last file passed to EnableTracing().
+ * @ingroup    ie_dev_profiling
+ */
+INFERENCE_ENGINE_API_CPP(void) DisableTracing();
+
+/**
+ * @brief      Writes the recorded events to the trace file. Events overwritten or being recorded concurrently
+ *             with the flush are skipped, so it should be called when there is no inference in flight.
+ * @ingroup    ie_dev_profiling
+ */
+INFERENCE_ENGINE_API_CPP(void) FlushTrace();
+
+/**
+ * @brief      Sets the name of the current thread shown in the trace
+ * @ingroup    ie_dev_profiling
+ * @param[in]  name  The thread name
+ */
+INFERENCE_ENGINE_API_CPP(void) SetTraceThreadName(const std::string& name);
+
+/**
+ * @brief      Returns the trace timestamp
+ * @ingroup    ie_dev_profiling
+ * @return     Microseconds since the tracer creation
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) GetTraceTimestamp();
+
+/**
+ * @brief      Returns unique identifier which binds the begin and the end of an asynchronous event
+ * @ingroup    ie_dev_profiling
+ * @return     The identifier
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) NewTraceId();
+
+/**
+ * @brief      Records the event of the current thread which started at `startTime` and ends now
+ * @ingroup    ie_dev_profiling
+ * @param[in]  category  The event category, must be a string literal
+ * @param[in]  name      The event name, it is copied and truncated to 63 characters
+ * @param[in]  startTime The event start timestamp returned by GetTraceTimestamp()
+ * @param[in]  id        Optional identifier shown in the event arguments, e.g. an infer request
+ */
+INFERENCE_ENGINE_API_CPP(void) TraceComplete(const char* category, const char* name, uint64_t startTime, uint64_t id = 0);
+
+/**
+ * @brief      Records the begin of the asynchronous event, it can end on the other thread
+ * @ingroup    ie_dev_profiling
+ * @param[in]  category  The event category, must be a string literal
+ * @param[in]  name      The event name
+ * @param[in]  id        The identifier returned by NewTraceId() or other unique value
+ */
+INFERENCE_ENGINE_API_CPP(void) TraceAsyncBegin(const char* category, const char* name, uint64_t id);
+
+/**
+ * @brief      Records the end of the asynchronous event
+ * @ingroup    ie_dev_profiling
+ * @param[in]  category  The category passed to TraceAsyncBegin()
+ * @param[in]  name      The name passed to TraceAsyncBegin()
+ * @param[in]  id        The identifier passed to TraceAsyncBegin()
+ */
+INFERENCE_ENGINE_API_CPP(void) TraceAsyncEnd(const char* category, const char* name, uint64_t id);
+
+/**
+ * @brief      Records the scope as a complete event if tracing is enabled at the scope entry
+ * @ingroup    ie_dev_profiling
+ */
+class TraceScope {
+public:
+    /**
+     * @brief      Starts the event
+     * @param[in]  category  The event category, must be a string literal
+     * @param[in]  name      The event name, must be valid till the end of the scope
+     * @param[in]  id        Optional identifier shown in the event arguments
+     */
+    TraceScope(const char* category, const char* name, uint64_t id = 0) :
+        _category{category}, _name{name}, _id{id}, _enabled{IsTracingEnabled()} {
+        if (_enabled) {
+            _start = GetTraceTimestamp();
+        }
+    }
+
+    /**
+     * @brief      Records the event
+     */
+    ~TraceScope() {
+        if (_enabled) {
+            TraceComplete(_category, _name, _start, _id);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* _category = nullptr;
+    const char* _name = nullptr;
+    uint64_t _id = 0;
+    uint64_t _start = 0;
+    bool _enabled = false;
+};
+
+}  // namespace InferenceEngine
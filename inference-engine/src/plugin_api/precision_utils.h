@@ -77,6 +77,12 @@ namespace InferenceEngine {
  */
 using ie_fp16 = short;
 
+/**
+ * @brief A type definition for BF16 data type. Defined as a signed short
+ * @ingroup ie_dev_api_precision
+ */
+using ie_bf16 = short;
+
 /**
  * @brief Namespace for precision utilities
  * @ingroup ie_dev_api_precision
@@ -129,6 +135,52 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 INFERENCE_ENGINE_API_CPP(void)
 f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+/**
+ * @brief      Converts a single-precision floating point value to a bfloat16 value with the same rounding as ngraph::bfloat16
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A single-precision floating point value
+ * @return     A bfloat16 value
+ */
+INFERENCE_ENGINE_API_CPP(ie_bf16) f32tobf16(float x);
+
+/**
+ * @brief      Converts a bfloat16 value to a single-precision floating point value
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A bfloat16 value
+ * @return     A single-precision floating point value
+ */
+INFERENCE_ENGINE_API_CPP(float) bf16tof32(ie_bf16 x);
+
+/**
+ * @brief      Converts a bfloat16 array to a single-precision floating point array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of bfloat16 values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief      Converts a single-precision floating point array to a bfloat16 array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of bfloat16 values
+ * @param[in]  src    A source array of single-precision floating point values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
 #if defined(_MSC_VER)
 #pragma warning(push)
 #pragma warning(disable : 4018)
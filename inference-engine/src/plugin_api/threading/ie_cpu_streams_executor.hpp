@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "threading/ie_istreams_executor.hpp"
 
@@ -20,7 +22,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Tasks are distributed between per-thread queues, idle threads steal tasks from other queues
+ *        preferring the threads on the same NUMA node.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -48,6 +51,22 @@ public:
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Counters of a single executor thread
+     */
+    struct Statistics {
+        size_t   queueDepth;    //!< Number of tasks waiting in the thread queue
+        uint64_t executed;      //!< Number of tasks executed by the thread
+        uint64_t stolen;        //!< Number of tasks the thread took from queues of other threads
+        uint64_t idleTimeUs;    //!< Time in microseconds the thread waited for tasks
+    };
+
+    /**
+     * @brief Returns counters of the executor threads
+     * @return Vector of counters, one per stream thread. It is empty if the executor has no own threads.
+     */
+    std::vector<Statistics> GetStatistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -6,6 +6,7 @@
 
 #include <ie_api.h>
 
+#include <cstddef>
 #include <tuple>
 #include <memory>
 
@@ -85,4 +86,28 @@ INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadByMask(int ncores, const CpuSet&
  * @return     `True` in case of success, `false` otherwise
  */
 INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadToSocket(int socket);
+
+/**
+ * @brief      Makes a NUMA node preferred for the pages of a memory range and moves already allocated pages there.
+ *             Only pages fully covered by the range are affected.
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  ptr         The beginning of the memory range
+ * @param[in]  size        The size of the memory range in bytes
+ * @param[in]  numaNodeId  The NUMA node id
+ * @return     `True` in case of success, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) BindMemoryToNumaNode(void* ptr, std::size_t size, int numaNodeId);
+
+/**
+ * @brief      Counts bytes of a memory range placed on a NUMA node and on the other nodes.
+ *             Pages which are not allocated by the system yet are not counted.
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  ptr         The beginning of the memory range
+ * @param[in]  size        The size of the memory range in bytes
+ * @param[in]  numaNodeId  The NUMA node id
+ * @return     A tuple of the number of bytes on the node and on the other nodes
+ */
+INFERENCE_ENGINE_API_CPP(std::tuple<std::size_t, std::size_t>) GetMemoryNumaLocality(const void* ptr, std::size_t size, int numaNodeId);
 }  //  namespace InferenceEngine
@@ -34,7 +34,8 @@ public:
 
     Blob::Ptr getRoiBlob() const override;
 
-    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
+    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1,
+                 bool normalize = false) override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
 };
@@ -54,7 +55,7 @@ Blob::Ptr PreProcessData::getRoiBlob() const {
 }
 
 void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial,
-        int batchSize) {
+        int batchSize, bool normalize) {
     OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing");
 
     auto algorithm = info.getResizeAlgorithm();
@@ -66,11 +67,21 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
 
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _userBlob);
 
+    PreprocEngine::Normalization normalization;
+    if (normalize) {
+        if (info.getMeanVariant() != MEAN_VALUE) {
+            THROW_IE_EXCEPTION << "Only MEAN_VALUE normalization can be fused with input pre-processing";
+        }
+        for (size_t c = 0; c < info.getNumberOfChannels(); ++c) {
+            normalization.emplace_back(info[c]->meanValue, info[c]->stdScale);
+        }
+    }
+
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize, normalization);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
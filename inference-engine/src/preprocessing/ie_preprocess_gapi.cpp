@@ -10,6 +10,8 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <list>
+#include <mutex>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -22,6 +24,7 @@
 #include "ie_preprocess_gapi.hpp"
 #include "ie_preprocess_gapi_kernels.hpp"
 #include "ie_preprocess_itt.hpp"
+#include "ie_tracer.hpp"
 #include "debug.h"
 
 #include "ie_parallel.hpp"
@@ -550,11 +553,24 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const PreprocEngine::Normalization& normalization) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
 
+    // mean/scale normalization is applied to the planar output with the conversion to the output
+    // precision, so each pixel is touched once
+    const bool normalize = !normalization.empty();
+    auto normalize_planes = [&](const std::vector<cv::GMat>& planes) {
+        std::vector<cv::GMat> normalized;
+        for (size_t c = 0; c < planes.size(); ++c) {
+            normalized.emplace_back(gapi::Normalize::on(planes[c], normalization[c].first,
+                                                        normalization[c].second, out_desc.prec));
+        }
+        return normalized;
+    };
+
     std::vector<cv::GMat> inputs;  // 1 element if NHWC, C elements if NCHW
     if (in_layout == NHWC) {
         inputs.resize(1);
@@ -575,7 +591,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
-                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
+                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec || normalize))
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
@@ -610,6 +626,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        if (normalize) {
+            planes = normalize_planes(planes);
+        }
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
@@ -665,7 +685,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (normalize) {
+        outputs = normalize_planes(outputs);
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -685,31 +707,105 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+// Compiled graphs shared by all engines of the process: requests of the same network (and of
+// the networks with the same inputs) alternate between a few descriptors, e.g. different camera
+// resolutions, so keeping only the last one would recompile the graph on each switch. A graph is
+// taken out of the cache for the time of execution, so it is never run by two requests at once.
+class PreprocEngine::GraphCache {
+public:
+    static GraphCache& instance() {
+        static GraphCache cache;
+        return cache;
+    }
+
+    // Returns the graphs compiled exactly for the call or nullptr
+    std::unique_ptr<CompiledGraphs> take(const CallDesc& call, int slices) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+            if ((*it)->slices == slices && (*it)->call == call) {
+                auto graphs = std::move(*it);
+                _entries.erase(it);
+                return graphs;
+            }
+        }
+        return {};
+    }
+
+    // Returns the graphs which can be reshaped for the call instead of compiling new ones: the graphs
+    // of the preferred call (the previous call of the engine) if possible, otherwise the least recently
+    // used ones. A call which lost its graphs to a reshape recently is recurring (e.g. the inputs
+    // alternate between resolutions), so nullptr is returned for it and it gets graphs of its own.
+    std::unique_ptr<CompiledGraphs> takeReshapeable(const CallDesc& call, int slices, const CallDesc* preferred) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto reshaped = std::find(_reshapedCalls.begin(), _reshapedCalls.end(), std::make_pair(call, slices));
+        if (reshaped != _reshapedCalls.end()) {
+            _reshapedCalls.erase(reshaped);
+            return {};
+        }
+
+        auto canReshape = [&](const std::unique_ptr<CompiledGraphs>& graphs) {
+            return graphs->slices == slices && needUpdate(graphs->call, call) == Update::RESHAPE;
+        };
+        auto found = _entries.end();
+        if (preferred != nullptr) {
+            found = std::find_if(_entries.begin(), _entries.end(), [&](const std::unique_ptr<CompiledGraphs>& graphs) {
+                return graphs->call == *preferred && canReshape(graphs);
+            });
+        }
+        if (found == _entries.end()) {
+            auto lru = std::find_if(_entries.rbegin(), _entries.rend(), canReshape);
+            if (lru == _entries.rend()) {
+                return {};
+            }
+            found = std::next(lru).base();
+        }
+
+        auto graphs = std::move(*found);
+        _entries.erase(found);
+        _reshapedCalls.emplace_front(graphs->call, graphs->slices);
+        if (_reshapedCalls.size() > capacity) {
+            _reshapedCalls.pop_back();
+        }
+        return graphs;
+    }
+
+    void put(std::unique_ptr<CompiledGraphs> graphs) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _entries.push_front(std::move(graphs));
+        while (_entries.size() > capacity) {
+            _entries.pop_back();
+        }
+    }
+
+private:
+    static constexpr std::size_t capacity = 32;
+
+    std::mutex _mutex;
+    std::list<std::unique_ptr<CompiledGraphs>> _entries;  // the most recently used first
+    std::list<std::pair<CallDesc, int>> _reshapedCalls;   // the calls which graphs were reshaped, the latest first
+};
+
+PreprocEngine::PreprocEngine() = default;
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
+    // 6. normalization has changed (mean and scale are kernel parameters)
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo, std::ignore) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    std::tie(new_in, new_out, new_algo, std::ignore) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -725,7 +821,8 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo ||
+        std::get<3>(lastCall) != std::get<3>(newCall)) {
         return Update::REBUILD;
     }
 
@@ -814,30 +911,19 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation, CompiledGraphs& graphs,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
-    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
+    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size,
     Update update) {
-
-    const int thread_num =
-#if IE_THREAD == IE_THREAD_OMP
-        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
-#endif
-        0;                  // use all available threads
-
-    // to suppress unused warnings
-    (void)(omp_serial);
-
-    // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
-    // that an actual number of threads will be as assumed, so it
-    // possible that all slices are processed by the same thread.
+    // Split the whole graph into `graphs.slices` slices, which is
+    // assumed to be number of threads used.  However it is not
+    // guaranteed that an actual number of threads will be as assumed,
+    // so it possible that all slices are processed by the same thread.
     //
-    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
+    parallel_nt_static(graphs.slices, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = graphs.compiled[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
@@ -898,7 +984,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const Normalization& normalization) {
 
     validateBlob(inBlob);
 
@@ -940,19 +1026,55 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  normalization };
 
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+    if (!normalization.empty()) {
+        if ((in_desc.prec != CV_8U && in_desc.prec != CV_32F) || out_desc.prec != CV_32F) {
+            THROW_IE_EXCEPTION  << "Normalization is supported for U8 or FP32 input and FP32 output only [by G-API]";
+        }
+        if (normalization.size() != static_cast<size_t>(out_desc.d.C)) {
+            THROW_IE_EXCEPTION  << "Normalization is specified for " << normalization.size()
+                                << " channels, but network's input has " << out_desc.d.C << " channels";
+        }
+    }
+
+    if (algorithm == NO_RESIZE && normalization.empty() && std::get<0>(thisCall) == std::get<1>(thisCall)) {
         //if requested output parameters match input blob no need to do anything
         THROW_IE_EXCEPTION  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+    // the graphs are compiled for the ROIs of the particular number of slices
+    const int slices =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        parallel_get_max_threads();  // use all available threads
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    auto& cache = GraphCache::instance();
+    auto graphs = cache.take(thisCall, slices);
+    Update update = Update::NOTHING;
+    if (!graphs) {
+        // a cache miss: reshape the cached graphs which differ by the input size only
+        graphs = cache.takeReshapeable(thisCall, slices, _lastCall ? &_lastCall.value() : nullptr);
+        if (graphs) {
+            update = Update::RESHAPE;
+        } else {
+            graphs.reset(new CompiledGraphs{});
+            graphs->slices = slices;
+            graphs->compiled.resize(slices);
+            update = Update::REBUILD;
+        }
+        graphs->call = thisCall;
+    }
+    OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, Update::NOTHING == update ? _perf_graph_cache_hit : _perf_graph_cache_miss);
+    TraceScope trace{"preprocessing", Update::NOTHING == update ? "graph cache hit" :
+                                      Update::RESHAPE == update ? "graph cache miss reshape" : "graph cache miss rebuild"};
 
     Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
         if (Update::REBUILD == update) {
             //  rebuild the graph
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
@@ -965,19 +1087,24 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           normalization));
         }
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    // the graphs are dropped if the execution throws as they might be partially reshaped
+    executeGraph(_lastComputation, *graphs, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+        update);
+    cache.put(std::move(graphs));
+    _lastCall = cv::util::make_optional(thisCall);
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const Normalization& normalization) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -997,7 +1124,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1006,7 +1133,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
 
     default:
@@ -1016,7 +1143,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
 }
 }  // namespace InferenceEngine
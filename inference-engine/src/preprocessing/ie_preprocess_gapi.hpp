@@ -8,7 +8,9 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <memory>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
@@ -21,39 +23,54 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    // Mean and scale of each output channel, empty if the output isn't normalized
+    using Normalization = std::vector<std::pair<float, float>>;
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
+    // Graphs compiled for the call, one per thread slice
+    struct CompiledGraphs {
+        CallDesc call;
+        int slices = 0;
+        std::vector<cv::GCompiled> compiled;
+    };
+    class GraphCache;
+
+    // The call processed last, its graphs are preferred for reshaping on a cache miss
     Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
     openvino::itt::handle_t _perf_exec_graph = openvino::itt::handle("Preproc Exec Graph");
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
+    openvino::itt::handle_t _perf_graph_cache_hit = openvino::itt::handle("Preproc Graph Cache Hit");
+    openvino::itt::handle_t _perf_graph_cache_miss = openvino::itt::handle("Preproc Graph Cache Miss");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      CompiledGraphs& graphs,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
-                      bool omp_serial,
                       Update update);
 
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const Normalization& normalization);
 
 public:
     PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const Normalization& normalization = {});
 };
 
 }  // namespace InferenceEngine
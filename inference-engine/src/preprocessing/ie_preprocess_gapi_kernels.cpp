@@ -2416,6 +2416,43 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+
+template <typename src_t>
+void normalize_row(const uint8_t* src, uint8_t* dst, const int width, const float mean, const float scale) {
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<float *>(dst);
+
+    for (int i = 0; i < width; i++) {
+        out[i] = (static_cast<float>(in[i]) - mean) * scale;
+    }
+}
+
+}  // namespace
+
+GAPI_FLUID_KERNEL(FNormalize, Normalize, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, float mean, float scale, int /*depth*/,
+                    cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F);
+        GAPI_Assert(dst.meta().depth == CV_32F);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        const auto *in  = src.InLineB(0);
+              auto *out = dst.OutLineB();
+
+        auto const width = dst.length();
+        if (src.meta().depth == CV_8U) {
+            normalize_row<uint8_t>(in, out, width, mean, scale);
+        } else {
+            normalize_row<float>(in, out, width, mean, scale);
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2443,6 +2480,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FNormalize
         >();
 }
 
@@ -152,6 +152,16 @@ namespace gapi {
         }
     };
 
+    // (in - mean) * scale, the normalization is fused with the conversion to the output depth
+    G_TYPED_KERNEL(Normalize, <cv::GMat(cv::GMat, float mean, float scale, int depth)>, "com.intel.ie.normalize") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float, float, int depth) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(depth == CV_32F);
+
+            return in.withDepth(depth);
+        }
+    };
+
 
 
     cv::gapi::GKernelPackage preprocKernels();
@@ -9,6 +9,7 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/op/util/sub_graph_base.hpp>
 #include <ngraph/op/util/variable.hpp>
@@ -22,11 +23,13 @@
 #include <sstream>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
 #include "precision_utils.h"
@@ -96,24 +99,25 @@ public:
         const Blob::CPtr& weights,
         const std::unordered_map<std::string, ngraph::OpSet>& opsets,
         std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
-        : node(node), weights(weights), opsets(opsets), variables(variables) {}
+        : node(node),
+          data_node(node.child("data")),
+          weights(weights),
+          opsets(opsets),
+          variables(variables) {}
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data_node, name, val)) return;
         value.set(val);
     }
     void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& value) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data_node, name, val)) return;
         std::transform(val.begin(), val.end(), val.begin(), [](char ch) {
             return std::tolower(static_cast<unsigned char>(ch));
         });
-        std::set<std::string> true_names{"true", "1"};
-        std::set<std::string> false_names{"false", "0"};
-
-        bool is_true = true_names.find(val) != true_names.end();
-        bool is_false = false_names.find(val) != false_names.end();
+        bool is_true = val == "true" || val == "1";
+        bool is_false = val == "false" || val == "0";
 
         if (!is_true && !is_false) return;
         value.set(is_true);
@@ -122,14 +126,14 @@ public:
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data_node, name, val)) return;
         double value;
         stringToType<double>(val, value);
         adapter.set(value);
     }
     void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
         std::string val;
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data_node, name, val)) return;
         int64_t value;
         stringToType<int64_t>(val, value);
         adapter.set(value);
@@ -142,21 +146,21 @@ public:
     void on_adapter(
         const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
         std::vector<int32_t> value;
-        if (!getParameters<int32_t>(node.child("data"), name, value)) return;
+        if (!getParameters<int32_t>(data_node, name, value)) return;
         adapter.set(value);
     }
 
     void on_adapter(
         const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
         std::vector<int64_t> value;
-        if (!getParameters<int64_t>(node.child("data"), name, value)) return;
+        if (!getParameters<int64_t>(data_node, name, value)) return;
         adapter.set(value);
     }
 
     void on_adapter(
         const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
         std::vector<float> value;
-        if (!getParameters<float>(node.child("data"), name, value)) return;
+        if (!getParameters<float>(data_node, name, value)) return;
         adapter.set(value);
     }
 
@@ -164,7 +168,7 @@ public:
         const std::string& name,
         ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
         std::vector<std::string> value;
-        if (!getParameters<std::string>(node.child("data"), name, value)) return;
+        if (!getParameters<std::string>(data_node, name, value)) return;
         adapter.set(value);
     }
 
@@ -211,6 +215,8 @@ private:
 
     // -- DATA --
     const pugi::xml_node node;
+    // attributes of an operation are read from its 'data' child, so it is looked up only once
+    const pugi::xml_node data_node;
     const Blob::CPtr& weights;
     const std::unordered_map<std::string, ngraph::OpSet>& opsets;
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables;
@@ -427,56 +433,56 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
         }
     }
 
-    if (skip_names.count(name) && !getStrAttribute(node.child("data"), name, val)) return;
+    if (skip_names.count(name) && !getStrAttribute(data_node, name, val)) return;
     if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::Type>>(&adapter)) {
         static_cast<ngraph::element::Type&>(*a) = details::convertPrecision(val);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::PartialShape>>(&adapter)) {
         std::vector<int64_t> shape;
         std::vector<ngraph::Dimension> dims;
-        if (!getParameters<int64_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<int64_t>(data_node, name, shape)) return;
         for (const auto& dim : shape) dims.emplace_back(dim);
         static_cast<ngraph::PartialShape&>(*a) = ngraph::PartialShape(dims);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::Shape>>(&adapter)) {
         std::vector<size_t> shape;
-        if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<size_t>(data_node, name, shape)) return;
         static_cast<ngraph::Shape&>(*a) = ngraph::Shape(shape);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::Strides>>(&adapter)) {
         std::vector<size_t> shape;
-        if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<size_t>(data_node, name, shape)) return;
         static_cast<ngraph::Strides&>(*a) = ngraph::Strides(shape);
 #ifdef __APPLE__
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<size_t>>>(&adapter)) {
         std::vector<size_t> result;
-        if (!getParameters<size_t>(node.child("data"), name, result)) return;
+        if (!getParameters<size_t>(data_node, name, result)) return;
         static_cast<std::vector<size_t>&>(*a) = result;
 #else
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<size_t>>>(&adapter)) {
         std::vector<size_t> result;
-        if (!getParameters<size_t>(node.child("data"), name, result)) return;
+        if (!getParameters<size_t>(data_node, name, result)) return;
         a->set(result);
 #endif
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::AxisSet>>(&adapter)) {
         std::vector<size_t> axes;
-        if (!getParameters<size_t>(node.child("data"), name, axes)) return;
+        if (!getParameters<size_t>(data_node, name, axes)) return;
         static_cast<ngraph::AxisSet&>(*a) = ngraph::AxisSet(axes);
     } else if (
         auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::TopKSortType>>(&adapter)) {
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data_node, name, val)) return;
         static_cast<ngraph::op::TopKSortType&>(*a) = ngraph::as_enum<ngraph::op::TopKSortType>(val);
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::TopKMode>>(&adapter)) {
-        if (!getStrAttribute(node.child("data"), name, val)) return;
+        if (!getStrAttribute(data_node, name, val)) return;
         static_cast<ngraph::op::TopKMode&>(*a) = ngraph::as_enum<ngraph::op::TopKMode>(val);
     } else if (
         auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::CoordinateDiff>>(&adapter)) {
         std::vector<size_t> shape;
-        if (!getParameters<size_t>(node.child("data"), name, shape)) return;
+        if (!getParameters<size_t>(data_node, name, shape)) return;
         std::vector<std::ptrdiff_t> coord_diff(shape.begin(), shape.end());
         static_cast<ngraph::CoordinateDiff&>(*a) = ngraph::CoordinateDiff(coord_diff);
     } else if (
         auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(
             &adapter)) {
         std::string variable_id;
-        if (!getStrAttribute(node.child("data"), name, variable_id)) return;
+        if (!getStrAttribute(data_node, name, variable_id)) return;
         if (!variables.count(variable_id)) {
             variables[variable_id] = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
                 ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
@@ -486,7 +492,7 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
         auto a = ngraph::as_type<
             ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
         std::string value;
-        pugi::xml_node dn = node.child("data");
+        pugi::xml_node dn = data_node;
         auto type = XMLParseUtils::GetStrAttr(node, "type");
 
         if (dn.empty()) THROW_IE_EXCEPTION << "No attrtibutes defined for " << type << " op!";
@@ -546,7 +552,7 @@ void XmlDeserializer::on_adapter(
 
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root, const Blob::CPtr& weights) {
-    OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
+    OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader_RT, "V10Parser", "ParseLayers");
 
     struct FunctionNodes {
         ngraph::ParameterVector parameters;
@@ -563,25 +569,51 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         V10Parser::GenericLayerParams params;
     };
 
-    std::map<size_t/*layer-id*/, node_params> params;
+    std::vector<pugi::xml_node> layers;
+    FOREACH_CHILD(node, root.child("layers"), "layer") {
+        layers.push_back(node);
+    }
+
+    // Generic parameters are read from independent parts of the read-only DOM,
+    // so large IRs are processed by all the threads; errors are rethrown from the calling thread
+    std::vector<V10Parser::GenericLayerParams> layers_params(layers.size());
+    std::exception_ptr parse_error;
+    std::mutex parse_error_mutex;
+    parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layers_params[i] = parseGenericParams(layers[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(parse_error_mutex);
+            if (!parse_error) parse_error = std::current_exception();
+        }
+    });
+    if (parse_error) std::rethrow_exception(parse_error);
+
+    OV_ITT_TASK_NEXT(taskChain, "ParseEdges");
+
+    std::unordered_map<size_t/*layer-id*/, node_params> params;
+    params.reserve(layers.size());
 
     std::vector<size_t/*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
+    opName.reserve(layers.size());
 
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
-        if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
+    // Store parameters of all layers in params map keeping the order of layers in the IR
+    for (size_t i = 0; i < layers.size(); i++) {
+        auto& node_param = layers_params[i];
+        if (!opName.insert(node_param.name).second && node_param.type != "Result")
             THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
-        opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        const size_t layerId = node_param.layerId;
+        params[layerId] = {layers[i], std::move(node_param)};
     }
 
-    std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t/*to-layer-id*/, std::vector<edge>> edges;
+    edges.reserve(layers.size());
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    id_to_node.reserve(layers.size());
 
     // Read all edges and store them for further usage
     FOREACH_CHILD(_ec, root.child("edges"), "edge") {
@@ -592,18 +624,31 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::set<size_t> used;
+    OV_ITT_TASK_NEXT(taskChain, "TopologicalSort");
+
+    // Run DFS starting from outputs to get nodes topological order.
+    // An explicit stack is used as deep models overflow the call stack with a recursive
+    // traversal; the visiting order is the same, so parameters and results keep their positions.
+    std::unordered_set<size_t> used;
+    used.reserve(layers.size());
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id)) return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    order.reserve(layers.size());
+    std::vector<std::pair<size_t/*layer-id*/, size_t/*next edge*/>> stack;
+    for (const auto output : outputs) {
+        if (!used.insert(output).second) continue;
+        stack.emplace_back(output, 0);
+        while (!stack.empty()) {
+            const size_t id = stack.back().first;
+            const auto& in_edges = edges[id];
+            if (stack.back().second < in_edges.size()) {
+                const size_t from = in_edges[stack.back().second++].fromLayerId;
+                if (used.insert(from).second) stack.emplace_back(from, 0);
+            } else {
+                order.push_back(id);
+                stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
 
@@ -816,7 +861,14 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         }
         ngraphNode->set_arguments(inputs);
         XmlDeserializer visitor(node, weights, opsets, variables);
-        if (ngraphNode->visit_attributes(visitor)) {
+        bool visited = false;
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::V10Reader_RT, "VisitAttributes");
+            visited = ngraphNode->visit_attributes(visitor);
+        }
+
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader_RT, "ValidateNode");
+        if (visited) {
             ngraphNode->constructor_validate_and_infer_types();
         }
 
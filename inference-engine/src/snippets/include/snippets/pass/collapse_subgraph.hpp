@@ -58,6 +58,7 @@ public:
  * New subgraph is introduced, if number of inputs and outputs exceeds 7 due to scheduling limitation
  * New subgraph is introduced, if multiple outputs of merged nodes are not broadcastable to each other (equality of all outputs is too much on the other hand)
  * Scalar constants are placed as is into subgraph due to optimization purpose
+ * Operations for which transformation callback returns true are not tokenized
  * @ingroup snippets
  */
 class TRANSFORMATIONS_API TokenizeSnippets: public ngraph::pass::GraphRewrite {
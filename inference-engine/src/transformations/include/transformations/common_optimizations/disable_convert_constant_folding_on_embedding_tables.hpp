@@ -0,0 +1,46 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API DisableConvertConstantFoldingOnEmbeddingTables;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief DisableConvertConstantFoldingOnEmbeddingTables transformation keeps low precision embedding tables
+ * from being folded to f32 constants, so a plugin can dequantize the table rows during the lookup.
+ * It marks Convert with DISABLED_CONSTANT_FOLDING in the following graph:
+ *
+ *   Constant (inputPrecisions)
+ *      |
+ *   Convert
+ *      |
+ *   [Subtract or Add with Constant]
+ *      |
+ *   [Multiply with Constant]
+ *      |
+ *   EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum (table input)
+ *   or Gather (data input, axis is 0)
+ *
+ * The dequantization constants have to be f32 scalars or hold one value per table row ([rows, 1, ...] shape).
+ */
+
+class ngraph::pass::DisableConvertConstantFoldingOnEmbeddingTables: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DisableConvertConstantFoldingOnEmbeddingTables(const std::vector<ngraph::element::Type>& inputPrecisions = {});
+};
@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/disable_convert_constant_folding_on_embedding_tables.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/variant.hpp>
+#include "itt.hpp"
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::DisableConvertConstantFoldingOnEmbeddingTables, "DisableConvertConstantFoldingOnEmbeddingTables", 0);
+
+namespace {
+
+ngraph::Node* get_single_consumer(const ngraph::Node* node, size_t& input_index) {
+    const auto target_inputs = node->output(0).get_target_inputs();
+    if (target_inputs.size() != 1)
+        return nullptr;
+    input_index = target_inputs.begin()->get_index();
+    return target_inputs.begin()->get_node();
+}
+
+bool is_embedding_table_input(const ngraph::Node* node, size_t input_index) {
+    if (input_index != 0)
+        return false;
+
+    if (ngraph::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(node) ||
+        ngraph::is_type<ngraph::opset3::EmbeddingBagPackedSum>(node) ||
+        ngraph::is_type<ngraph::opset3::EmbeddingSegmentsSum>(node))
+        return true;
+
+    if (ngraph::is_type<ngraph::opset1::Gather>(node)) {
+        auto axis = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(2));
+        return axis && ngraph::shape_size(axis->get_shape()) == 1 && axis->cast_vector<int64_t>()[0] == 0;
+    }
+
+    return false;
+}
+
+// the plugins dequantize the table rows with the values given per table or per row, so only
+// f32 scalars and [rows, 1, ...] constants are accepted
+bool is_row_constant(const ngraph::Node* node, const ngraph::Shape& table_shape) {
+    const auto constant = ngraph::as_type<const ngraph::opset1::Constant>(node);
+    if (!constant || constant->get_element_type() != ngraph::element::f32)
+        return false;
+    const auto& shape = constant->get_shape();
+    const size_t size = ngraph::shape_size(shape);
+    if (size == 1)
+        return true;
+    return shape.size() == table_shape.size() && shape[0] == table_shape[0] && size == table_shape[0];
+}
+
+}  // namespace
+
+ngraph::pass::DisableConvertConstantFoldingOnEmbeddingTables::DisableConvertConstantFoldingOnEmbeddingTables(
+    const std::vector<ngraph::element::Type>& inputPrecisions) {
+    MATCHER_SCOPE(DisableConvertConstantFoldingOnEmbeddingTables);
+    auto table_pattern = ngraph::pattern::wrap_type<opset1::Constant>();
+    auto convert_pattern = ngraph::pattern::wrap_type<opset1::Convert>({ table_pattern }, pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto convert = m.get_match_root();
+        if (!inputPrecisions.empty() &&
+            std::find(inputPrecisions.begin(), inputPrecisions.end(), convert->get_input_element_type(0)) == inputPrecisions.end())
+            return false;
+        const auto table_shape = convert->get_input_shape(0);
+        if (table_shape.size() < 2)
+            return false;
+
+        // skip the dequantization operations (zero point, then scale) with constant parameters
+        size_t input_index = 0;
+        const ngraph::Node* node = convert.get();
+        auto consumer = get_single_consumer(node, input_index);
+        if (consumer && (is_type<opset1::Subtract>(consumer) || is_type<opset1::Add>(consumer)) &&
+            is_row_constant(consumer->get_input_node_ptr(1 - input_index), table_shape)) {
+            if (is_type<opset1::Subtract>(consumer) && input_index != 0)
+                return false;
+            node = consumer;
+            consumer = get_single_consumer(node, input_index);
+        }
+        if (consumer && is_type<opset1::Multiply>(consumer) &&
+            is_row_constant(consumer->get_input_node_ptr(1 - input_index), table_shape)) {
+            node = consumer;
+            consumer = get_single_consumer(node, input_index);
+        }
+
+        if (!consumer || !is_embedding_table_input(consumer, input_index))
+            return false;
+
+        auto& rt_info = convert->get_rt_info();
+        rt_info["DISABLED_CONSTANT_FOLDING"] = std::make_shared<VariantWrapper<std::string>>("");
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert_pattern, matcher_name);
+    this->register_matcher(m, callback);
+}
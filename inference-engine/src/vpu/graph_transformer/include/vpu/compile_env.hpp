@@ -55,6 +55,20 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    // Makes the environment of the compiling thread visible from a worker thread till the end of the scope,
+    // the workers must not modify it.
+    class ThreadScope final {
+    public:
+        explicit ThreadScope(const CompileEnv& env);
+        ~ThreadScope();
+
+        ThreadScope(const ThreadScope&) = delete;
+        ThreadScope& operator=(const ThreadScope&) = delete;
+
+    private:
+        CompileEnv* _prevEnv = nullptr;
+    };
+
 private:
     explicit CompileEnv(Platform platform);
 };
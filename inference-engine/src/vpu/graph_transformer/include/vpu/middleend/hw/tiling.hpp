@@ -17,6 +17,7 @@
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/utils/io.hpp>
 #include <vpu/utils/dot_io.hpp>
+#include <vpu/utils/func_ref.hpp>
 
 namespace vpu {
 
@@ -315,4 +316,13 @@ HwConvTileInfo splitHwConvIntoOutChannelsTiles(
         int kernelSizeX, int kernelSizeY,
         int kernelStride);
 
+//
+// Tiling search
+//
+
+// Runs `searchTiling(stageInd)` for every stage index in [0, numStages) across the thread pool.
+// The search must not modify the model, the failure of the first stage in the order is rethrown,
+// so the result is the same as for the sequential loop.
+void parallelTilingSearch(std::size_t numStages, const FuncRef<void(std::size_t)>& searchTiling);
+
 }  // namespace vpu
@@ -138,6 +138,16 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+CompileEnv::ThreadScope::ThreadScope(const CompileEnv& env) : _prevEnv(g_compileEnv) {
+    IE_ASSERT(env.initialized);
+
+    g_compileEnv = const_cast<CompileEnv*>(&env);
+}
+
+CompileEnv::ThreadScope::~ThreadScope() {
+    g_compileEnv = _prevEnv;
+}
+
 //
 // compileNetwork
 //
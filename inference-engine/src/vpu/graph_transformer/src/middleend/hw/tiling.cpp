@@ -10,7 +10,11 @@
 #include <vector>
 #include <limits>
 #include <utility>
+#include <exception>
 
+#include <ie_parallel.hpp>
+
+#include <vpu/compile_env.hpp>
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/utils/numeric.hpp>
 
@@ -575,4 +579,31 @@ HwConvTileInfo splitHwConvIntoOutChannelsTiles(
     return tileInfo;
 }
 
+//
+// Tiling search
+//
+
+void parallelTilingSearch(std::size_t numStages, const FuncRef<void(std::size_t)>& searchTiling) {
+    const auto& env = CompileEnv::get();
+
+    // the exceptions can't leave OpenMP parallel regions
+    std::vector<std::exception_ptr> errors(numStages);
+
+    InferenceEngine::parallel_for(numStages, [&](std::size_t stageInd) {
+        CompileEnv::ThreadScope envScope(env);
+
+        try {
+            searchTiling(stageInd);
+        } catch (...) {
+            errors[stageInd] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 }  // namespace vpu
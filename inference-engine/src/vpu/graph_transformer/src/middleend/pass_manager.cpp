@@ -8,6 +8,12 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <map>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <ie_tracer.hpp>
 
 #include <vpu/compile_env.hpp>
 
@@ -31,6 +37,39 @@ void PerStagePass::run(const Model& model) {
 // PassSet
 //
 
+namespace {
+
+using PassDurations = std::map<std::string, std::pair<int, double>>;
+
+// Logs the time spent in each pass, the most expensive ones first
+void reportPassDurations(const Logger::Ptr& log, const PassDurations& passDurations, std::size_t numPasses, double totalDuration) {
+    std::vector<const PassDurations::value_type*> sortedDurations;
+    sortedDurations.reserve(passDurations.size());
+    for (const auto& passDuration : passDurations) {
+        sortedDurations.push_back(&passDuration);
+    }
+
+    std::stable_sort(sortedDurations.begin(), sortedDurations.end(),
+        [](const PassDurations::value_type* lhs, const PassDurations::value_type* rhs) {
+            return lhs->second.second > rhs->second.second;
+        });
+
+    log->info("MiddleEnd : %d passes duration : %f ms", numPasses, totalDuration);
+    VPU_LOGGER_SECTION(log);
+
+    for (const auto passDuration : sortedDurations) {
+        const auto runs = passDuration->second.first;
+        const auto duration = passDuration->second.second;
+
+        log->info(
+            "[%s] x%d : %f ms (%f %%)",
+            passDuration->first, runs, duration,
+            totalDuration > 0.0 ? 100.0 * duration / totalDuration : 0.0);
+    }
+}
+
+}  // namespace
+
 void PassSet::run(const Model& model) const {
     using MilliSecondsFP64 = std::chrono::duration<double, std::milli>;
 
@@ -39,6 +78,10 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    // pass name -> { number of runs, total duration }
+    PassDurations passDurations;
+    double totalDuration = 0.0;
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -46,21 +89,35 @@ void PassSet::run(const Model& model) const {
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        model->cleanUp();
+        {
+            InferenceEngine::TraceScope trace{"vpu", p.second.c_str()};
+
+            model->cleanUp();
 
-        p.first->run(model);
+            p.first->run(model);
+        }
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
+
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        auto& passDuration = passDurations[p.second];
+        ++passDuration.first;
+        passDuration.second += duration;
+        totalDuration += duration;
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    if (env.log->isActive(LogLevel::Info)) {
+        reportPassDurations(env.log, passDurations, _passes.size(), totalDuration);
+    }
 }
 
 //
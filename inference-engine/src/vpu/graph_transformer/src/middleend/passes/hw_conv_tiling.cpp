@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -34,6 +35,9 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> hwStagesOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -51,15 +55,8 @@ void PassImpl::run(const Model& model) {
         // Unsupported paddings
         //
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        hwStages.push_back(origStage);
+        hwStagesOptions.push_back(HWTilingNS::ConvolutionOptions{
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -72,33 +69,56 @@ void PassImpl::run(const Model& model) {
             stageOptions.padTop,
             stageOptions.padBottom,
             stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+        });
+    }
+
+    //
+    // Try to find "best" tiling
+    //
+
+    // The search doesn't touch the model, so it runs for all the stages in parallel,
+    // the model is modified below in the original stages order.
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    std::vector<std::unique_ptr<HWTilingNS::HWConvolutionTiler>> tilers(hwStages.size());
+
+    parallelTilingSearch(hwStages.size(), [&](std::size_t stageInd) {
+        const auto& convolutionOptions = hwStagesOptions[stageInd];
+
+        std::unique_ptr<HWTilingNS::HWConvolutionTiler> tiler(
+            new HWTilingNS::HWConvolutionTiler(convolutionOptions, direction, tilingsCount));
+
+        if (!tiler->isTilingPossible() && tiler->withPool()) {
+            const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
+                convolutionOptions._stageName,
+                convolutionOptions._inputDims,
+                convolutionOptions._origOutputDims,
+                convolutionOptions._origOutputDims,
+                convolutionOptions._kernelSizeX,
+                convolutionOptions._kernelSizeY,
+                convolutionOptions._kernelStride,
+                convolutionOptions._paddingLeft,
+                convolutionOptions._paddingRight,
+                convolutionOptions._paddingTop,
+                convolutionOptions._paddingBottom,
+                false
+            };
+
+            tiler.reset(new HWTilingNS::HWConvolutionTiler(optionsWithoutPool, direction, tilingsCount));
+        }
+
+        tilers[stageInd] = std::move(tiler);
+    });
+
+    for (std::size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+        const auto& tiler = *tilers[stageInd];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
@@ -9,8 +9,10 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
 
 #include <vpu/stages/stub_stage.hpp>
+#include <vpu/middleend/hw/tiling.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_stage_tiler.hpp>
@@ -32,6 +34,9 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> hwStagesOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -46,16 +51,8 @@ void PassImpl::run(const Model& model) {
         const HWPoolStageOptions stageOptions(origStage);
         const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction =
-                HWTilingNS::Direction::INPUT_TO_OUTPUT;
-        // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        hwStages.push_back(origStage);
+        hwStagesOptions.push_back(HWTilingNS::ConvolutionOptions{
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -67,9 +64,32 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            false};
+            false});
+    }
+
+    //
+    // Try to find "best" tiling
+    //
 
-        const HWTilingNS::HWPoolingTiler tiler(convolutionOptions, direction, tilingsCount);
+    // Only the search runs in parallel, the tiles are created in the stages order.
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction =
+            HWTilingNS::Direction::INPUT_TO_OUTPUT;
+    // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    std::vector<std::unique_ptr<HWTilingNS::HWPoolingTiler>> tilers(hwStages.size());
+
+    parallelTilingSearch(hwStages.size(), [&](std::size_t stageInd) {
+        tilers[stageInd].reset(new HWTilingNS::HWPoolingTiler(hwStagesOptions[stageInd], direction, tilingsCount));
+    });
+
+    for (std::size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+        const auto& tiler = *tilers[stageInd];
+
+        const HWPoolStageOptions stageOptions(origStage);
+        const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
         if (!tiler.isTilingPossible()) {
             origStage->attrs().set<bool>("tryHW", false);
@@ -3,6 +3,8 @@
 //
 
 #include <future>
+#include <mutex>
+#include <set>
 
 #include <gtest/gtest.h>
 
@@ -211,3 +213,55 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+TEST(CPUStreamsExecutorTests, statisticsCountAllExecutedTasks) {
+    static constexpr const auto NUMBER_OF_TASKS = 1000;
+    auto streams = std::max(2, getNumberOfCPUCores());
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                           streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::vector<Future> futures;
+    for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+        futures.emplace_back(async(taskExecutor, [] {}));
+    }
+    for (auto&& f : futures) f.wait();
+
+    auto statistics = taskExecutor->GetStatistics();
+    ASSERT_EQ(static_cast<size_t>(streams), statistics.size());
+    uint64_t executed = 0;
+    uint64_t stolen = 0;
+    for (auto&& stream : statistics) {
+        executed += stream.executed;
+        stolen += stream.stolen;
+    }
+    // a task future is ready before the executor increments its counter
+    ASSERT_LE(static_cast<uint64_t>(NUMBER_OF_TASKS - streams), executed);
+    ASSERT_GE(static_cast<uint64_t>(NUMBER_OF_TASKS), executed);
+    ASSERT_GE(executed, stolen);
+}
+
+TEST(CPUStreamsExecutorTests, workerThreadsUseStreamsOfTheirQueues) {
+    static constexpr const auto NUMBER_OF_TASKS = 1000;
+    auto streams = std::max(2, getNumberOfCPUCores());
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                           streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    // a thread outside of the executor takes a stream before any worker does
+    int externalStreamId = -1;
+    taskExecutor->Execute([&] { externalStreamId = taskExecutor->GetStreamId(); });
+    ASSERT_EQ(streams, externalStreamId);
+
+    std::mutex mutex;
+    std::set<int> streamIds;
+    std::vector<Future> futures;
+    for (int i = 0; i < NUMBER_OF_TASKS; i++) {
+        futures.emplace_back(async(taskExecutor, [&] {
+            auto streamId = taskExecutor->GetStreamId();
+            std::lock_guard<std::mutex> lock{mutex};
+            streamIds.insert(streamId);
+        }));
+    }
+    for (auto&& f : futures) f.wait();
+
+    ASSERT_FALSE(streamIds.empty());
+    ASSERT_LE(0, *streamIds.begin());
+    ASSERT_GT(streams, *streamIds.rbegin());
+}
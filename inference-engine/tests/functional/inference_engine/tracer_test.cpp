@@ -0,0 +1,145 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_tracer.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+namespace {
+
+std::string readTrace(const std::string& path) {
+    FlushTrace();
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+std::size_t countOccurrences(const std::string& str, const std::string& substr) {
+    std::size_t count = 0;
+    for (auto pos = str.find(substr); pos != std::string::npos; pos = str.find(substr, pos + substr.size())) {
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(TracerTests, canWriteChromeTrace) {
+    const std::string path = "tracer_test_trace.json";
+    EnableTracing(path);
+    ASSERT_TRUE(IsTracingEnabled());
+
+    SetTraceThreadName("tracer_test");
+    {
+        TraceScope scope{"test", "outer \"scope\"", 42};
+        const auto id = NewTraceId();
+        TraceAsyncBegin("test", "async", id);
+        TraceAsyncEnd("test", "async", id);
+    }
+
+    auto trace = readTrace(path);
+    DisableTracing();
+    ASSERT_FALSE(IsTracingEnabled());
+    std::remove(path.c_str());
+    ASSERT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"tracer_test\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"outer \\\"scope\\\"\",\"cat\":\"test\",\"ph\":\"X\""));
+    ASSERT_NE(std::string::npos, trace.find("\"args\":{\"id\":42}"));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"async\",\"cat\":\"test\",\"ph\":\"b\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"async\",\"cat\":\"test\",\"ph\":\"e\""));
+}
+
+TEST(TracerTests, tracesExecutorQueue) {
+    const std::string path = "tracer_test_executor_trace.json";
+    EnableTracing(path);
+    {
+        CPUStreamsExecutor executor{IStreamsExecutor::Config{"TracedExecutor", 1}};
+        std::promise<void> promise;
+        executor.run([&] { promise.set_value(); });
+        promise.get_future().wait();
+    }
+
+    // the executor threads have exited already, their events are kept
+    auto trace = readTrace(path);
+    DisableTracing();
+    std::remove(path.c_str());
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"TracedExecutor_0\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"queued\",\"cat\":\"executor\",\"ph\":\"b\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"task\",\"cat\":\"executor\",\"ph\":\"X\""));
+}
+
+TEST(TracerTests, flushSkipsEventsBeingRecorded) {
+    const std::string path = "tracer_test_concurrent_trace.json";
+    EnableTracing(path);
+
+    // a torn copy of the event would mix the names, e.g. "baaa"
+    const std::string longName(63, 'a');
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> recorded{0};
+    std::thread writer([&] {
+        SetTraceThreadName("tracer_test_writer");
+        for (uint64_t i = 0; !stop; ++i) {
+            TraceComplete("test", i % 2 ? longName.c_str() : "b", GetTraceTimestamp(), i + 1);
+            recorded = i + 1;
+        }
+    });
+    while (recorded < 1000) {
+        std::this_thread::yield();
+    }
+    std::vector<std::string> traces;
+    for (int i = 0; i < 20; ++i) {
+        traces.push_back(readTrace(path));
+    }
+    stop = true;
+    writer.join();
+    DisableTracing();
+    std::remove(path.c_str());
+
+    for (const auto& trace : traces) {
+        ASSERT_EQ(std::string::npos, trace.find("\"name\":\"ba"));
+        ASSERT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+    }
+    ASSERT_NE(std::string::npos, traces.back().find("\"name\":\"b\",\"cat\":\"test\",\"ph\":\"X\""));
+}
+
+TEST(TracerTests, dropsOldestBuffersOfExitedThreads) {
+    const std::string path = "tracer_test_exited_trace.json";
+    EnableTracing(path);
+
+    constexpr int threadsNumber = 40;
+    constexpr int eventsPerThread = 2000;
+    for (int t = 0; t < threadsNumber; ++t) {
+        std::thread([t] {
+            SetTraceThreadName("tracer_test_exited_" + std::to_string(t));
+            for (int i = 0; i < eventsPerThread; ++i) {
+                TraceComplete("test", "event", GetTraceTimestamp());
+            }
+        }).join();
+    }
+
+    auto trace = readTrace(path);
+    DisableTracing();
+    std::remove(path.c_str());
+
+    // the buffers are shrunk to the recorded events and the newest ones are kept
+    const auto keptThreads = countOccurrences(trace, "\"name\":\"tracer_test_exited_");
+    ASSERT_LT(0u, keptThreads);
+    ASSERT_GT(static_cast<std::size_t>(threadsNumber), keptThreads);
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"tracer_test_exited_" + std::to_string(threadsNumber - 1) + "\""));
+    ASSERT_EQ(std::string::npos, trace.find("\"name\":\"tracer_test_exited_0\""));
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <transformations/common_optimizations/disable_convert_constant_folding_on_embedding_tables.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+
+std::shared_ptr<Function> makeEmbeddingBag(const element::Type& table_type, bool with_dequantization,
+                                           const Shape& scale_shape = Shape{10, 1}) {
+    auto table = opset3::Constant::create(table_type, Shape{10, 4}, std::vector<float>(40, 3));
+    std::shared_ptr<Node> dequantized = std::make_shared<opset3::Convert>(table, element::f32);
+    if (with_dequantization) {
+        auto zero_point = opset3::Constant::create(element::f32, Shape{10, 1}, std::vector<float>(10, 1));
+        auto scale = opset3::Constant::create(element::f32, scale_shape, std::vector<float>(shape_size(scale_shape), 0.5));
+        dequantized = std::make_shared<opset3::Subtract>(dequantized, zero_point);
+        dequantized = std::make_shared<opset3::Multiply>(dequantized, scale);
+    }
+    auto indices = std::make_shared<opset3::Parameter>(element::i32, Shape{3, 2});
+    auto bag = std::make_shared<opset3::EmbeddingBagPackedSum>(dequantized, indices);
+    return std::make_shared<Function>(NodeVector{bag}, ParameterVector{indices});
+}
+
+void runPasses(const std::shared_ptr<Function>& f) {
+    pass::Manager m;
+    m.register_pass<pass::InitNodeInfo>();
+    m.register_pass<pass::DisableConvertConstantFoldingOnEmbeddingTables>(std::vector<element::Type>{ element::i8, element::u8 });
+    m.register_pass<pass::ConstantFolding>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+}
+
+size_t countConverts(const std::shared_ptr<Function>& f) {
+    size_t count = 0;
+    for (const auto& node : f->get_ops())
+        count += is_type<opset3::Convert>(node) ? 1 : 0;
+    return count;
+}
+
+}  // namespace
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnEmbeddingTables) {
+    auto f = makeEmbeddingBag(element::i8, false);
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 1);
+}
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnDequantizedEmbeddingTables) {
+    auto f = makeEmbeddingBag(element::u8, true);
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 1);
+}
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnEmbeddingTablesScalarScale) {
+    auto f = makeEmbeddingBag(element::u8, true, Shape{});
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 1);
+}
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnEmbeddingTablesSkipsPerColumnScale) {
+    auto f = makeEmbeddingBag(element::u8, true, Shape{1, 4});
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 0);
+}
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnEmbeddingTablesSkipsPerElementScale) {
+    auto f = makeEmbeddingBag(element::u8, true, Shape{10, 4});
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 0);
+}
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnEmbeddingTablesGatherAxis0) {
+    auto table = opset3::Constant::create(element::i8, Shape{10, 4}, std::vector<float>(40, 3));
+    auto convert = std::make_shared<opset3::Convert>(table, element::f32);
+    auto indices = std::make_shared<opset3::Parameter>(element::i32, Shape{3});
+    auto axis = opset3::Constant::create(element::i64, Shape{}, {0});
+    auto gather = std::make_shared<opset3::Gather>(convert, indices, axis);
+    auto f = std::make_shared<Function>(NodeVector{gather}, ParameterVector{indices});
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 1);
+}
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnEmbeddingTablesSkipsOtherPrecisions) {
+    auto f = makeEmbeddingBag(element::i32, true);
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 0);
+}
+
+TEST(TransformationTests, DisableConvertConstantFoldingOnEmbeddingTablesSkipsOtherConsumers) {
+    auto table = opset3::Constant::create(element::i8, Shape{10, 4}, std::vector<float>(40, 3));
+    auto convert = std::make_shared<opset3::Convert>(table, element::f32);
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{10, 4});
+    auto add = std::make_shared<opset3::Add>(data, convert);
+    auto f = std::make_shared<Function>(NodeVector{add}, ParameterVector{data});
+    runPasses(f);
+    ASSERT_EQ(countConverts(f), 0);
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+#include "ngraph_functions/subgraph_builders.hpp"
+
+#include "behavior/compiled_network_cache.hpp"
+
+using namespace BehaviorTestsDefinitions;
+namespace {
+    const std::vector<InferenceEngine::Precision> netPrecisions = {
+            InferenceEngine::Precision::FP32
+    };
+
+    const std::vector<std::map<std::string, std::string>> configs = {
+            {},
+    };
+
+    INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CompiledNetworkCacheTests,
+                            ::testing::Combine(
+                                    ::testing::ValuesIn(netPrecisions),
+                                    ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                    ::testing::ValuesIn(configs)),
+                            CompiledNetworkCacheTests::getTestCaseName);
+
+    // TensorIterator without RNN cells in the body is kept by the CPU plugin transformations
+    std::shared_ptr<ngraph::Function> makeTIwithAdd() {
+        auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 5, 4});
+        auto init = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 4});
+
+        auto x = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 4});
+        auto h = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 4});
+        auto add = std::make_shared<ngraph::opset5::Add>(x, h);
+        auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{add}, ngraph::ParameterVector{x, h});
+
+        auto tensorIterator = std::make_shared<ngraph::opset5::TensorIterator>();
+        tensorIterator->set_body(body);
+        tensorIterator->set_sliced_input(x, data, 0, 1, 1, -1, 1);
+        tensorIterator->set_merged_input(h, init, add);
+        auto out = tensorIterator->get_iter_value(add, -1);
+
+        return std::make_shared<ngraph::Function>(ngraph::OutputVector{out}, ngraph::ParameterVector{data, init});
+    }
+
+    TEST(CompiledNetworkCacheCPUTests, smoke_tensorIteratorNetworkIsNotExported) {
+        InferenceEngine::Core core;
+        InferenceEngine::CNNNetwork network(makeTIwithAdd());
+        auto execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+        std::stringstream stream;
+        ASSERT_THROW(execNet.Export(stream), InferenceEngine::details::InferenceEngineException);
+        ASSERT_TRUE(stream.str().empty());
+    }
+
+    TEST(CompiledNetworkCacheCPUTests, smoke_tensorIteratorNetworkIsLoadedWithoutCache) {
+        const std::string cacheDir = "compiled_network_cache_ti";
+        {
+            InferenceEngine::Core core;
+            InferenceEngine::CNNNetwork network(makeTIwithAdd());
+            core.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+
+            InferenceEngine::ExecutableNetwork execNet;
+            ASSERT_NO_THROW(execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+            ASSERT_NO_THROW(execNet.CreateInferRequest().Infer());
+            ASSERT_EQ(1u, core.GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(NUMBER_OF_CACHE_MISSES)).as<unsigned int>());
+        }
+
+        std::vector<std::string> files;
+        CommonTestUtils::directoryFileListRecursive(cacheDir, files);
+        CommonTestUtils::removeDir(cacheDir);
+        ASSERT_TRUE(files.empty());
+    }
+
+    std::map<std::string, std::string> getImplementationTypes(InferenceEngine::ExecutableNetwork& execNet) {
+        std::map<std::string, std::string> types;
+        for (auto&& node : execNet.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::IMPL_TYPE);
+            if (it != rtInfo.end()) {
+                types[node->get_friendly_name()] = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second)->get();
+            }
+        }
+        return types;
+    }
+
+    TEST(CompiledNetworkCacheCPUTests, smoke_importedNetworkKeepsImplementationTypes) {
+        InferenceEngine::Core core;
+        InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+        auto execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+        std::stringstream stream;
+        execNet.Export(stream);
+        const auto exported = stream.str();
+        ASSERT_NE(std::string::npos, exported.find("<primitives>"));
+
+        auto importedNet = core.ImportNetwork(stream, CommonTestUtils::DEVICE_CPU);
+        ASSERT_EQ(getImplementationTypes(execNet), getImplementationTypes(importedNet));
+
+        // the stored implementations are ignored on another CPU, the network is still imported
+        const std::string isa = " isa=\"";
+        auto otherCpu = exported;
+        auto isaPos = otherCpu.find(isa);
+        ASSERT_NE(std::string::npos, isaPos);
+        otherCpu.insert(isaPos + isa.size(), "other ");
+        std::stringstream otherCpuStream(otherCpu);
+        ASSERT_NO_THROW(importedNet = core.ImportNetwork(otherCpuStream, CommonTestUtils::DEVICE_CPU));
+        ASSERT_NO_THROW(importedNet.CreateInferRequest().Infer());
+    }
+}  // namespace
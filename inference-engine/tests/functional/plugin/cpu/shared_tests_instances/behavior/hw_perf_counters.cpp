@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+// the plugin reports nothing if the task clock can't be opened (non-Linux system or perf_event_paranoid)
+bool taskClockIsAvailable() {
+#ifdef __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_SOFTWARE;
+    attr.config = PERF_COUNT_SW_TASK_CLOCK;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0)
+        return false;
+    close(fd);
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string getRuntimeInfo(const std::shared_ptr<ngraph::Node>& node, const std::string& key) {
+    const auto& rtInfo = node->get_rt_info();
+    auto it = rtInfo.find(key);
+    if (it == rtInfo.end())
+        return {};
+    auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+    return value ? value->get() : std::string{};
+}
+
+TEST(HwPerfCountersCPUTests, smoke_nodeCountersAreReported) {
+    if (!taskClockIsAvailable())
+        GTEST_SKIP() << "perf_event counters are not available";
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu({1, 16, 64, 64}));
+    auto execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                    {{CONFIG_KEY(CPU_HW_PERF_COUNTERS), CONFIG_VALUE(YES)},
+                                     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)}});
+    auto request = execNet.CreateInferRequest();
+    request.SetBlob(execNet.GetInputsInfo().begin()->first,
+                    FuncTestUtils::createAndFillBlob(execNet.GetInputsInfo().begin()->second->getTensorDesc()));
+    for (int i = 0; i < 3; i++)
+        request.Infer();
+
+    // cpu_uSec is the CPU time of the threads, which is non-zero for the executed convolution at least
+    long long cpuTime = 0;
+    for (const auto& layer : request.GetPerformanceCounts()) {
+        if (layer.second.status == InferenceEngine::InferenceEngineProfileInfo::EXECUTED)
+            cpuTime += layer.second.cpu_uSec;
+    }
+    ASSERT_LT(0, cpuTime);
+
+    auto execFunction = execNet.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execFunction);
+    size_t nodesWithCounters = 0;
+    uint64_t execGraphCpuTime = 0;
+    for (const auto& node : execFunction->get_ops()) {
+        if (getRuntimeInfo(node, ExecGraphInfoSerialization::PERF_CPU_TIME).empty())
+            continue;
+        nodesWithCounters++;
+        for (const auto& key : {ExecGraphInfoSerialization::PERF_CYCLES, ExecGraphInfoSerialization::PERF_INSTRUCTIONS,
+                                ExecGraphInfoSerialization::PERF_CACHE_MISSES, ExecGraphInfoSerialization::PERF_BYTES_READ,
+                                ExecGraphInfoSerialization::PERF_BYTES_WRITTEN}) {
+            ASSERT_FALSE(getRuntimeInfo(node, key).empty()) << node->get_friendly_name() << " has no " << key;
+        }
+        execGraphCpuTime += std::stoull(getRuntimeInfo(node, ExecGraphInfoSerialization::PERF_CPU_TIME));
+    }
+    ASSERT_LT(0u, nodesWithCounters);
+    ASSERT_LT(0u, execGraphCpuTime);
+}
+
+// the counters cover the whole process, so the other streams would be charged to the nodes
+TEST(HwPerfCountersCPUTests, smoke_singleStreamIsForced) {
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    auto execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                    {{CONFIG_KEY(CPU_HW_PERF_COUNTERS), CONFIG_VALUE(YES)},
+                                     {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "4"}});
+    ASSERT_EQ("1", execNet.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+    ASSERT_EQ(1u, execNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+
+    auto throughputNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                          {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "4"}});
+    ASSERT_EQ("4", throughputNet.GetConfig(CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+}
+
+TEST(HwPerfCountersCPUTests, smoke_nodeCountersAreNotReportedByDefault) {
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    auto execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    execNet.CreateInferRequest().Infer();
+
+    for (const auto& node : execNet.GetExecGraphInfo().getFunction()->get_ops())
+        ASSERT_TRUE(getRuntimeInfo(node, ExecGraphInfoSerialization::PERF_CPU_TIME).empty());
+}
+
+}  // namespace
@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace {
+
+using NumaStatistics = std::map<std::string, uint64_t>;
+
+// large enough for the graph buffers to take several pages
+InferenceEngine::CNNNetwork makeNetwork() {
+    return InferenceEngine::CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu({1, 16, 64, 64}));
+}
+
+// runs one inference per stream, so every stream creates its graph
+std::vector<InferenceEngine::Blob::Ptr> inferAllStreams(InferenceEngine::ExecutableNetwork& execNet,
+                                                        const InferenceEngine::Blob::Ptr& input) {
+    const auto streams = execNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < streams; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        requests.back().SetBlob(execNet.GetInputsInfo().begin()->first, input);
+        requests.back().StartAsync();
+    }
+    std::vector<InferenceEngine::Blob::Ptr> outputs;
+    for (auto& request : requests) {
+        request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+        outputs.push_back(request.GetBlob(execNet.GetOutputsInfo().begin()->first));
+    }
+    return outputs;
+}
+
+TEST(NumaMemoryStatisticsCPUTests, smoke_metricIsSupported) {
+    InferenceEngine::Core core;
+    auto execNet = core.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+
+    std::vector<std::string> metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(NUMA_MEMORY_STATISTICS)));
+
+    NumaStatistics statistics;
+    ASSERT_NO_THROW(statistics = execNet.GetMetric(METRIC_KEY(NUMA_MEMORY_STATISTICS)).as<NumaStatistics>());
+    ASSERT_EQ(1u, statistics.count("LOCAL_BYTES"));
+    ASSERT_EQ(1u, statistics.count("REMOTE_BYTES"));
+}
+
+TEST(NumaMemoryStatisticsCPUTests, smoke_memoryIsNotCountedWithoutNumaBinding) {
+    InferenceEngine::Core core;
+    auto execNet = core.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                    {{CONFIG_KEY(CPU_BIND_THREAD), CONFIG_VALUE(NO)},
+                                     {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_VALUE(CPU_THROUGHPUT_NUMA)}});
+    auto input = FuncTestUtils::createAndFillBlob(execNet.GetInputsInfo().begin()->second->getTensorDesc());
+    inferAllStreams(execNet, input);
+
+    auto statistics = execNet.GetMetric(METRIC_KEY(NUMA_MEMORY_STATISTICS)).as<NumaStatistics>();
+    ASSERT_EQ(0u, statistics["LOCAL_BYTES"]);
+    ASSERT_EQ(0u, statistics["REMOTE_BYTES"]);
+}
+
+TEST(NumaMemoryStatisticsCPUTests, smoke_numaBindingGivesSameResults) {
+    InferenceEngine::Core core;
+    auto network = makeNetwork();
+    auto refNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                    {{CONFIG_KEY(CPU_BIND_THREAD), CONFIG_VALUE(NUMA)},
+                                     {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_VALUE(CPU_THROUGHPUT_NUMA)}});
+
+    auto input = FuncTestUtils::createAndFillBlob(execNet.GetInputsInfo().begin()->second->getTensorDesc());
+    auto refOutput = inferAllStreams(refNet, input).front();
+    for (auto& output : inferAllStreams(execNet, input)) {
+        FuncTestUtils::compareBlobs(output, refOutput);
+    }
+
+    auto statistics = execNet.GetMetric(METRIC_KEY(NUMA_MEMORY_STATISTICS)).as<NumaStatistics>();
+    if (InferenceEngine::getAvailableNUMANodes().size() < 2) {
+        // the streams memory is not bound on a single NUMA node machine
+        ASSERT_EQ(0u, statistics["LOCAL_BYTES"]);
+        ASSERT_EQ(0u, statistics["REMOTE_BYTES"]);
+    } else {
+        ASSERT_LT(0u, statistics["LOCAL_BYTES"]);
+        ASSERT_LE(statistics["REMOTE_BYTES"], statistics["LOCAL_BYTES"]);
+    }
+}
+
+}  // namespace
@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <blob_factory.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+namespace {
+
+const std::vector<float> meanValues = {10.5f, 20.f, 127.25f};
+
+// out = in + 1, the network takes U8 input
+InferenceEngine::CNNNetwork makeAddOne(const ngraph::Shape& shape) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    param->set_friendly_name("input");
+    auto add = std::make_shared<ngraph::opset1::Add>(param, ngraph::opset1::Constant::create(ngraph::element::f32, {}, {1.f}));
+    add->set_friendly_name("output");
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{param});
+    InferenceEngine::CNNNetwork network(function);
+    network.getInputsInfo().begin()->second->setPrecision(InferenceEngine::Precision::U8);
+    return network;
+}
+
+void setMeanValues(InferenceEngine::CNNNetwork& network, size_t channels) {
+    auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    preProcess.init(channels);
+    for (size_t c = 0; c < channels; c++) {
+        preProcess[c]->meanValue = meanValues[c];
+        preProcess[c]->stdScale = 1.f;
+    }
+    preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+}
+
+InferenceEngine::Blob::Ptr infer(InferenceEngine::Core& core, const InferenceEngine::CNNNetwork& network,
+                                 const InferenceEngine::Blob::Ptr& input) {
+    auto request = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    request.SetBlob(network.getInputsInfo().begin()->first, input);
+    request.Infer();
+    return request.GetBlob(network.getOutputsInfo().begin()->first);
+}
+
+struct NormalizationCase {
+    std::string name;
+    size_t channels;
+    InferenceEngine::ResizeAlgorithm algorithm;
+};
+
+// U8 NHWC input is resized with the mean values subtracted in the same G-API pass. The result matches
+// the separate path, where the resized U8 blob is converted and the mean is subtracted by the graph
+TEST(PreprocessingNormalizationCPUTests, smoke_resizeWithMeanValueMatchesSeparateMean) {
+    const std::vector<NormalizationCase> cases = {
+        {"RGB8U bilinear", 3, InferenceEngine::RESIZE_BILINEAR},  // the RGB8U fast path
+        {"3 channels area", 3, InferenceEngine::RESIZE_AREA},
+        {"1 channel bilinear", 1, InferenceEngine::RESIZE_BILINEAR},
+    };
+    const size_t height = 24, width = 32;
+    const size_t inputHeight = 37, inputWidth = 53;
+
+    InferenceEngine::Core core;
+    for (const auto& testCase : cases) {
+        SCOPED_TRACE(testCase.name);
+        const ngraph::Shape shape = {1, testCase.channels, height, width};
+        auto input = FuncTestUtils::createAndFillBlob(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {1, testCase.channels, inputHeight, inputWidth},
+                                        InferenceEngine::Layout::NHWC), 250);
+
+        // the resize only gives the pre-processed U8 values to feed the separate path with
+        auto resizeNetwork = makeAddOne(shape);
+        resizeNetwork.getInputsInfo().begin()->second->getPreProcess().setResizeAlgorithm(testCase.algorithm);
+        auto resizedPlusOne = infer(core, resizeNetwork, input);
+
+        auto resized = make_blob_with_precision(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, shape, InferenceEngine::Layout::NCHW));
+        resized->allocate();
+        {
+            const auto* src = resizedPlusOne->cbuffer().as<const float*>();
+            auto* dst = resized->buffer().as<uint8_t*>();
+            for (size_t i = 0; i < resized->size(); i++)
+                dst[i] = static_cast<uint8_t>(src[i] - 1.f);
+        }
+
+        // no resize, so the blob is pushed as is and the graph subtracts the mean
+        auto separateNetwork = makeAddOne(shape);
+        setMeanValues(separateNetwork, testCase.channels);
+        auto expected = infer(core, separateNetwork, resized);
+
+        auto fusedNetwork = makeAddOne(shape);
+        setMeanValues(fusedNetwork, testCase.channels);
+        fusedNetwork.getInputsInfo().begin()->second->getPreProcess().setResizeAlgorithm(testCase.algorithm);
+        auto actual = infer(core, fusedNetwork, input);
+
+        ASSERT_EQ(expected->size(), actual->size());
+        const auto* expectedData = expected->cbuffer().as<const float*>();
+        const auto* actualData = actual->cbuffer().as<const float*>();
+        for (size_t i = 0; i < expected->size(); i++) {
+            const size_t c = i / (height * width);
+            ASSERT_NEAR(expectedData[i], actualData[i], 1e-4f) << "at index " << i;
+            // the mean is subtracted exactly once
+            ASSERT_NEAR(resizedPlusOne->cbuffer().as<const float*>()[i] - meanValues[c], actualData[i], 1e-4f)
+                << "at index " << i;
+        }
+    }
+}
+
+}  // namespace
@@ -0,0 +1,178 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <blob_factory.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+namespace {
+
+using ZeroCopyStatistics = std::map<std::string, std::map<std::string, uint64_t>>;
+
+constexpr int inferencesNumber = 3;
+
+// out = in + 1, the values are converted from and to the given types around the addition
+InferenceEngine::CNNNetwork makeAddOne(const ngraph::element::Type& inputType, const ngraph::element::Type& outputType,
+                                       const ngraph::Shape& shape) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(inputType, shape);
+    param->set_friendly_name("input");
+    std::shared_ptr<ngraph::Node> node = param;
+    if (inputType != ngraph::element::f32)
+        node = std::make_shared<ngraph::opset1::Convert>(node, ngraph::element::f32);
+    node = std::make_shared<ngraph::opset1::Add>(node, ngraph::opset1::Constant::create(ngraph::element::f32, {}, {1.f}));
+    if (outputType != ngraph::element::f32)
+        node = std::make_shared<ngraph::opset1::Convert>(node, outputType);
+    node->set_friendly_name("output");
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{node}, ngraph::ParameterVector{param});
+    return InferenceEngine::CNNNetwork(function);
+}
+
+float getValue(const InferenceEngine::Blob::Ptr& blob, size_t index) {
+    switch (blob->getTensorDesc().getPrecision()) {
+        case InferenceEngine::Precision::FP32: return blob->cbuffer().as<const float*>()[index];
+        case InferenceEngine::Precision::I32: return static_cast<float>(blob->cbuffer().as<const int32_t*>()[index]);
+        case InferenceEngine::Precision::U8: return static_cast<float>(blob->cbuffer().as<const uint8_t*>()[index]);
+        default: THROW_IE_EXCEPTION << "Unsupported precision " << blob->getTensorDesc().getPrecision();
+    }
+}
+
+// checks out = in + 1 - mean for the first elementsNumber elements
+void checkAddOne(const InferenceEngine::Blob::Ptr& input, const InferenceEngine::Blob::Ptr& output,
+                 size_t elementsNumber, float mean = 0.f) {
+    ASSERT_EQ(input->size(), output->size());
+    for (size_t i = 0; i < elementsNumber; i++)
+        ASSERT_EQ(getValue(input, i) + 1.f - mean, getValue(output, i)) << "at index " << i;
+}
+
+ZeroCopyStatistics getStatistics(const InferenceEngine::ExecutableNetwork& execNet) {
+    return execNet.GetMetric(METRIC_KEY(ZERO_COPY_STATISTICS)).as<ZeroCopyStatistics>();
+}
+
+TEST(ZeroCopyStatisticsCPUTests, smoke_metricIsSupported) {
+    InferenceEngine::Core core;
+    auto execNet = core.LoadNetwork(makeAddOne(ngraph::element::f32, ngraph::element::f32, {1, 3, 8, 8}),
+                                    CommonTestUtils::DEVICE_CPU);
+
+    std::vector<std::string> metrics = execNet.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(metrics.end(), std::find(metrics.begin(), metrics.end(), METRIC_KEY(ZERO_COPY_STATISTICS)));
+    ASSERT_NO_THROW(getStatistics(execNet));
+}
+
+// the blobs of the request and the user blobs of the same precision and layout are used by the graph directly
+TEST(ZeroCopyStatisticsCPUTests, smoke_nonFloatBlobsAreNotCopied) {
+    const std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> precisions = {
+        {ngraph::element::f32, ngraph::element::f32},
+        {ngraph::element::u8, ngraph::element::i32},
+        {ngraph::element::i32, ngraph::element::i32},
+        {ngraph::element::u8, ngraph::element::u8},
+    };
+    InferenceEngine::Core core;
+    for (const auto& precision : precisions) {
+        SCOPED_TRACE(precision.first.get_type_name() + "->" + precision.second.get_type_name());
+        auto execNet = core.LoadNetwork(makeAddOne(precision.first, precision.second, {1, 3, 8, 8}),
+                                        CommonTestUtils::DEVICE_CPU);
+        const auto inputName = execNet.GetInputsInfo().begin()->first;
+        const auto outputName = execNet.GetOutputsInfo().begin()->first;
+        auto request = execNet.CreateInferRequest();
+
+        // the blobs allocated by the request
+        for (int i = 0; i < inferencesNumber; i++) {
+            auto input = FuncTestUtils::createAndFillBlob(execNet.GetInputsInfo().begin()->second->getTensorDesc(), 100);
+            auto requestInput = request.GetBlob(inputName);
+            std::copy_n(input->cbuffer().as<const uint8_t*>(), input->byteSize(), requestInput->buffer().as<uint8_t*>());
+            request.Infer();
+            checkAddOne(requestInput, request.GetBlob(outputName), requestInput->size());
+        }
+
+        // the user blobs
+        auto input = FuncTestUtils::createAndFillBlob(execNet.GetInputsInfo().begin()->second->getTensorDesc(), 100);
+        auto output = make_blob_with_precision(execNet.GetOutputsInfo().begin()->second->getTensorDesc());
+        output->allocate();
+        request.SetBlob(inputName, input);
+        request.SetBlob(outputName, output);
+        for (int i = 0; i < inferencesNumber; i++) {
+            request.Infer();
+            checkAddOne(input, output, input->size());
+        }
+
+        auto statistics = getStatistics(execNet);
+        ASSERT_EQ(2u * inferencesNumber, statistics[inputName]["ZERO_COPY"]);
+        ASSERT_EQ(0u, statistics[inputName]["COPIED"]);
+        ASSERT_EQ(2u * inferencesNumber, statistics[outputName]["ZERO_COPY"]);
+        ASSERT_EQ(0u, statistics[outputName]["COPIED"]);
+    }
+}
+
+// the mean image is subtracted in the graph input memory, so the user data is copied there
+TEST(ZeroCopyStatisticsCPUTests, smoke_inputWithMeanImageIsCopied) {
+    const float mean = 2.f;
+    auto network = makeAddOne(ngraph::element::f32, ngraph::element::f32, {1, 3, 8, 8});
+    auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    preProcess.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        preProcess[c]->meanData = make_blob_with_precision(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {8, 8}, InferenceEngine::Layout::HW));
+        preProcess[c]->meanData->allocate();
+        auto data = preProcess[c]->meanData->buffer().as<float*>();
+        std::fill_n(data, preProcess[c]->meanData->size(), mean);
+    }
+    preProcess.setVariant(InferenceEngine::MEAN_IMAGE);
+
+    InferenceEngine::Core core;
+    auto execNet = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    const auto inputName = execNet.GetInputsInfo().begin()->first;
+    const auto outputName = execNet.GetOutputsInfo().begin()->first;
+    auto request = execNet.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(execNet.GetInputsInfo().begin()->second->getTensorDesc());
+    request.SetBlob(inputName, input);
+    auto reference = FuncTestUtils::createAndFillBlob(input->getTensorDesc());
+    for (int i = 0; i < inferencesNumber; i++) {
+        request.Infer();
+        // the user data stays intact
+        FuncTestUtils::compareBlobs(input, reference);
+        checkAddOne(input, request.GetBlob(outputName), input->size(), mean);
+    }
+
+    auto statistics = getStatistics(execNet);
+    ASSERT_EQ(0u, statistics[inputName]["ZERO_COPY"]);
+    ASSERT_EQ(static_cast<uint64_t>(inferencesNumber), statistics[inputName]["COPIED"]);
+    ASSERT_EQ(static_cast<uint64_t>(inferencesNumber), statistics[outputName]["ZERO_COPY"]);
+}
+
+// dynamic batch processes a part of the tensors, so both the inputs and the outputs are copied
+TEST(ZeroCopyStatisticsCPUTests, smoke_dynamicBatchIsCopied) {
+    InferenceEngine::Core core;
+    auto execNet = core.LoadNetwork(makeAddOne(ngraph::element::f32, ngraph::element::f32, {4, 3, 8, 8}),
+                                    CommonTestUtils::DEVICE_CPU,
+                                    {{CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_VALUE(YES)}});
+    const auto inputName = execNet.GetInputsInfo().begin()->first;
+    const auto outputName = execNet.GetOutputsInfo().begin()->first;
+    auto request = execNet.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob(execNet.GetInputsInfo().begin()->second->getTensorDesc());
+    request.SetBlob(inputName, input);
+    request.SetBatch(2);
+    for (int i = 0; i < inferencesNumber; i++) {
+        request.Infer();
+        checkAddOne(input, request.GetBlob(outputName), input->size() / 2);
+    }
+
+    auto statistics = getStatistics(execNet);
+    for (const auto& name : {inputName, outputName}) {
+        ASSERT_EQ(0u, statistics[name]["ZERO_COPY"]);
+        ASSERT_EQ(static_cast<uint64_t>(inferencesNumber), statistics[name]["COPIED"]);
+    }
+}
+
+}  // namespace
@@ -0,0 +1,16 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "multi/multi_batching_tests.hpp"
+#include "multi/multi_scheduling_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+const std::vector<DevicesNames> device_names {
+        {CPU}, // CPU via MULTI
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_MultiCPU, MultiDevice_Test,
+        ::testing::ValuesIn(device_names), MultiDevice_Test::getTestCaseName);
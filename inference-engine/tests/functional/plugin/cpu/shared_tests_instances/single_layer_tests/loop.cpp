@@ -57,6 +57,16 @@ namespace {
                                     Values<InferenceEngine::SizeVector>({2, 1, 4}),
                                     Values<InferenceEngine::Precision>(Precision::FP32, Precision::I32),
                                     Values(CommonTestUtils::DEVICE_CPU)));
+    // the batch is larger than the number of threads, but the special ports keep the loop in one body
+    INSTANTIATE_TEST_CASE_P(smoke_StaticShapeLoop_LargeBatch, StaticShapeLoopTest,
+                            Combine(
+                                    Values(false),
+                                    Values(true),
+                                    ValuesIn(static_loop_types),
+                                    Values<int64_t>(7),
+                                    Values<InferenceEngine::SizeVector>({256, 1, 4}),
+                                    Values<InferenceEngine::Precision>(Precision::FP32),
+                                    Values(CommonTestUtils::DEVICE_CPU)));
     using namespace testing;
     INSTANTIATE_TEST_CASE_P(smoke_TrivialLoop, TrivialLoopTest,
                             Combine(
@@ -18,7 +18,10 @@ namespace {
         midOutputType::Sum
     };
 
-    std::map<std::string, std::string> additional_config = {};
+    std::vector<std::map<std::string, std::string>> additional_configs = {
+        {},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, InferenceEngine::PluginConfigParams::YES}}
+    };
 } // namespace
 
 INSTANTIATE_TEST_CASE_P(OutputBeforeActivation, OutputBeforeActivation,
@@ -27,6 +30,6 @@ INSTANTIATE_TEST_CASE_P(OutputBeforeActivation, OutputBeforeActivation,
         ::testing::Values(InferenceEngine::Precision::FP32),
         ::testing::ValuesIn(input_sizes),
         ::testing::ValuesIn(midLayerTypes),
-        ::testing::Values(additional_config)),
+        ::testing::ValuesIn(additional_configs)),
     OutputBeforeActivation::getTestCaseName);
 } // namespace SubgraphTestsDefinitions
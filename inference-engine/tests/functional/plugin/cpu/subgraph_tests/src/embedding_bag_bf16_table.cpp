@@ -0,0 +1,144 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ie_system_conf.h>
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class EmbeddingBagType {
+    OFFSETS_SUM,
+    SEGMENTS_SUM
+};
+
+typedef std::tuple<
+        EmbeddingBagType,
+        std::vector<size_t>,    // Embedding table shape
+        std::vector<size_t>,    // Indices
+        std::vector<size_t>,    // Offsets of the bags or segment ids
+        bool,                   // With per-sample weights
+        bool,                   // With default index
+        std::string             // Device name
+> EmbeddingBagBF16TableTuple;
+
+// The table is computed by Relu, so with enforced BF16 it comes to EmbeddingBag in BF16 and is read as is.
+// The inputs are small integers, which are exact in BF16, so the result matches the FP32 reference.
+class EmbeddingBagBF16TableTest : public testing::WithParamInterface<EmbeddingBagBF16TableTuple>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagBF16TableTuple> &obj) {
+        EmbeddingBagType type;
+        std::vector<size_t> tableShape, indices, offsets;
+        bool withWeights, withDefaultIndex;
+        std::string targetName;
+        std::tie(type, tableShape, indices, offsets, withWeights, withDefaultIndex, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << (type == EmbeddingBagType::OFFSETS_SUM ? "EmbeddingBagOffsetsSum" : "EmbeddingSegmentsSum") << "_";
+        results << "ETS=" << CommonTestUtils::vec2str(tableShape) << "_";
+        results << "I" << CommonTestUtils::vec2str(indices) << "_";
+        results << "O" << CommonTestUtils::vec2str(offsets) << "_";
+        results << "WW" << withWeights << "_";
+        results << "WDI" << withDefaultIndex << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        EmbeddingBagType type;
+        std::vector<size_t> tableShape, indices, offsets;
+        bool withWeights, withDefaultIndex;
+        std::tie(type, tableShape, indices, offsets, withWeights, withDefaultIndex, targetDevice) = this->GetParam();
+
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::YES});
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {tableShape});
+        auto table = std::make_shared<ngraph::opset1::Relu>(params[0]);
+
+        const size_t defaultIndex = 0;
+        std::shared_ptr<ngraph::Node> embBag;
+        if (type == EmbeddingBagType::OFFSETS_SUM) {
+            embBag = ngraph::builder::makeEmbeddingBagOffsetsSum(ngraph::element::f32, ngraph::element::i32, table,
+                                                                 indices, offsets, defaultIndex, withWeights, withDefaultIndex);
+        } else {
+            const size_t numSegments = offsets.back() + 2;
+            embBag = ngraph::builder::makeEmbeddingSegmentsSum(ngraph::element::f32, ngraph::element::i32, table,
+                                                               indices, offsets, numSegments, defaultIndex, withWeights, withDefaultIndex);
+        }
+        embBag->set_friendly_name("EmbeddingBag");
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(embBag)};
+        function = std::make_shared<ngraph::Function>(results, params, "embedding_bag_bf16_table");
+    }
+
+    void CheckTablePrecision() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+
+        for (const auto &node : execFunction->get_ops()) {
+            if (node->get_friendly_name() != "EmbeddingBag")
+                continue;
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+            // the table is not converted to FP32 before the layer
+            ASSERT_EQ("BF16", value->get());
+            return;
+        }
+        FAIL() << "EmbeddingBag layer is not found in the execution graph";
+    }
+};
+
+TEST_P(EmbeddingBagBF16TableTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // BF16 is not enforced without AVX512
+    if (!InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    Run();
+    CheckTablePrecision();
+}
+
+namespace {
+
+// the empty bags get the default row or zeros
+INSTANTIATE_TEST_CASE_P(smoke_EmbeddingBagOffsetsSumBF16Table, EmbeddingBagBF16TableTest,
+                        ::testing::Combine(
+                                ::testing::Values(EmbeddingBagType::OFFSETS_SUM),
+                                ::testing::Values(std::vector<size_t>{10, 35}, std::vector<size_t>{5, 4, 16}),
+                                ::testing::Values(std::vector<size_t>{0, 1, 2, 2, 3}, std::vector<size_t>{4, 4, 3, 1, 0}),
+                                ::testing::Values(std::vector<size_t>{0, 2}, std::vector<size_t>{0, 0, 2, 2, 4}),
+                                ::testing::Values(false, true),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingBagBF16TableTest::getTestCaseName);
+
+// segments between and after the used ones are empty
+INSTANTIATE_TEST_CASE_P(smoke_EmbeddingSegmentsSumBF16Table, EmbeddingBagBF16TableTest,
+                        ::testing::Combine(
+                                ::testing::Values(EmbeddingBagType::SEGMENTS_SUM),
+                                ::testing::Values(std::vector<size_t>{10, 35}, std::vector<size_t>{5, 4, 16}),
+                                ::testing::Values(std::vector<size_t>{0, 1, 2, 2, 3}, std::vector<size_t>{4, 4, 3, 1, 0}),
+                                ::testing::Values(std::vector<size_t>{0, 0, 2, 2, 4}, std::vector<size_t>{1, 1, 1, 3, 3}),
+                                ::testing::Values(false, true),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingBagBF16TableTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,166 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class TableLookupType {
+    EMBEDDING_BAG_OFFSETS_SUM,
+    EMBEDDING_BAG_PACKED_SUM,
+    GATHER
+};
+
+typedef std::tuple<
+        TableLookupType,
+        ngraph::element::Type,  // Embedding table precision
+        std::vector<size_t>,    // Embedding table shape
+        bool,                   // Zero point is subtracted
+        bool,                   // Scales are given per row, otherwise per table
+        std::string             // Device name
+> EmbeddingTableDecompressionTuple;
+
+// Low precision table dequantized by Convert -> [Subtract] -> Multiply right before the lookup.
+// The CPU plugin fuses the dequantization into the lookup, so the layer reads the compressed table.
+class EmbeddingTableDecompressionTest : public testing::WithParamInterface<EmbeddingTableDecompressionTuple>,
+                                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingTableDecompressionTuple> &obj) {
+        TableLookupType type;
+        ngraph::element::Type tablePrecision;
+        std::vector<size_t> tableShape;
+        bool withZeroPoint, perRowScales;
+        std::string targetName;
+        std::tie(type, tablePrecision, tableShape, withZeroPoint, perRowScales, targetName) = obj.param;
+        std::ostringstream results;
+
+        switch (type) {
+            case TableLookupType::EMBEDDING_BAG_OFFSETS_SUM: results << "EmbeddingBagOffsetsSum_"; break;
+            case TableLookupType::EMBEDDING_BAG_PACKED_SUM: results << "EmbeddingBagPackedSum_"; break;
+            case TableLookupType::GATHER: results << "Gather_"; break;
+        }
+        results << "TP=" << tablePrecision << "_";
+        results << "ETS=" << CommonTestUtils::vec2str(tableShape) << "_";
+        results << "ZP" << withZeroPoint << "_";
+        results << "PRS" << perRowScales << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        TableLookupType type;
+        std::vector<size_t> tableShape;
+        bool withZeroPoint, perRowScales;
+        std::tie(type, tablePrecision, tableShape, withZeroPoint, perRowScales, targetDevice) = this->GetParam();
+
+        const size_t rows = tableShape[0];
+        std::vector<size_t> rowShape(tableShape.size(), 1);
+        rowShape[0] = rows;
+
+        auto table = ngraph::builder::makeConstant<uint8_t>(tablePrecision, tableShape, {}, true, 100);
+        std::shared_ptr<ngraph::Node> dequantized = std::make_shared<ngraph::opset1::Convert>(table, ngraph::element::f32);
+        if (withZeroPoint) {
+            auto zeroPoint = ngraph::builder::makeConstant<float>(ngraph::element::f32, rowShape, {}, true, 5);
+            dequantized = std::make_shared<ngraph::opset1::Subtract>(dequantized, zeroPoint);
+        }
+        auto scales = perRowScales ?
+                      ngraph::builder::makeConstant<float>(ngraph::element::f32, rowShape, {}, true, 4) :
+                      ngraph::builder::makeConstant<float>(ngraph::element::f32, {}, {0.25f});
+        dequantized = std::make_shared<ngraph::opset1::Multiply>(dequantized, scales);
+
+        const std::vector<size_t> indices = {0, rows - 1, 2, 2, 1};
+        std::shared_ptr<ngraph::Node> lookup;
+        switch (type) {
+            case TableLookupType::EMBEDDING_BAG_OFFSETS_SUM:
+                lookup = ngraph::builder::makeEmbeddingBagOffsetsSum(ngraph::element::f32, ngraph::element::i32, dequantized,
+                                                                     indices, {0, 2, 2}, 0, true, true);
+                break;
+            case TableLookupType::EMBEDDING_BAG_PACKED_SUM:
+                lookup = ngraph::builder::makeEmbeddingBagPackedSum(ngraph::element::f32, ngraph::element::i32, dequantized,
+                                                                    {{0, rows - 1}, {2, 2}, {1, 0}}, true);
+                break;
+            case TableLookupType::GATHER: {
+                auto indicesNode = ngraph::builder::makeConstant<size_t>(ngraph::element::i32, {indices.size()}, indices);
+                auto axis = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {}, {0});
+                lookup = std::make_shared<ngraph::opset1::Gather>(dequantized, indicesNode, axis);
+                break;
+            }
+        }
+        lookup->set_friendly_name("TableLookup");
+
+        // the lookup inputs are constant, so the network input is added to the result
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {lookup->get_output_shape(0)});
+        auto add = std::make_shared<ngraph::opset1::Add>(lookup, params[0]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, params, "embedding_table_decompression");
+    }
+
+    void CheckTablePrecision() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+
+        const std::string expectedPrecision = tablePrecision == ngraph::element::i8 ? "I8" : "U8";
+        for (const auto &node : execFunction->get_ops()) {
+            if (node->get_friendly_name() != "TableLookup")
+                continue;
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+            // the table is not decompressed to FP32 before the layer
+            ASSERT_EQ(expectedPrecision, value->get());
+            return;
+        }
+        FAIL() << "TableLookup layer is not found in the execution graph";
+    }
+
+    ngraph::element::Type tablePrecision;
+};
+
+TEST_P(EmbeddingTableDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckTablePrecision();
+}
+
+namespace {
+
+const std::vector<TableLookupType> lookupTypes = {
+        TableLookupType::EMBEDDING_BAG_OFFSETS_SUM,
+        TableLookupType::EMBEDDING_BAG_PACKED_SUM,
+        TableLookupType::GATHER
+};
+
+const std::vector<ngraph::element::Type> tablePrecisions = {
+        ngraph::element::u8,
+        ngraph::element::i8
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_EmbeddingTableDecompression, EmbeddingTableDecompressionTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(lookupTypes),
+                                ::testing::ValuesIn(tablePrecisions),
+                                ::testing::Values(std::vector<size_t>{10, 35}, std::vector<size_t>{5, 4, 16}),
+                                ::testing::Values(false, true),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingTableDecompressionTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,109 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<std::vector<size_t>>,   // Input shapes
+        std::string                         // Device name
+> SnippetsEltwiseTuple;
+
+// Add has two consumers, so it starts a snippet which then absorbs the rest of the chain
+class SnippetsEltwiseTest : public testing::WithParamInterface<SnippetsEltwiseTuple>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsEltwiseTuple> &obj) {
+        std::vector<std::vector<size_t>> inputShapes;
+        std::string targetName;
+        std::tie(inputShapes, targetName) = obj.param;
+        std::ostringstream results;
+
+        for (int i = 0; i < inputShapes.size(); i++) {
+            results << "IS" << std::to_string(i) << "=" << CommonTestUtils::vec2str(inputShapes[i]) << "_";
+        }
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<std::vector<size_t>> inputShapes;
+        std::tie(inputShapes, targetDevice) = this->GetParam();
+
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE, InferenceEngine::PluginConfigParams::YES});
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inputShapes);
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+
+        auto add = std::make_shared<ngraph::opset1::Add>(paramOuts[0], paramOuts[1]);
+        auto mul = std::make_shared<ngraph::opset1::Multiply>(add, paramOuts[2]);
+        auto sub = std::make_shared<ngraph::opset1::Subtract>(add, mul);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(sub);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+        function = std::make_shared<ngraph::Function>(results, params, "snippets_eltwise");
+    }
+
+    // The whole eltwise chain is expected to be replaced by a single snippet
+    void CheckSnippetIsUsed() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+
+        size_t snippetCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+
+            const auto layerType = value->get();
+            if (layerType == "Subgraph") {
+                snippetCount++;
+            }
+            ASSERT_NE("Eltwise", layerType) << "Eltwise node " << node->get_friendly_name() << " was not fused into the snippet";
+        }
+        ASSERT_EQ(1u, snippetCount);
+    }
+};
+
+TEST_P(SnippetsEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckSnippetIsUsed();
+}
+
+namespace {
+
+std::vector<std::vector<std::vector<size_t>>> inputShapes {
+        {{1, 3, 16, 16}, {1, 3, 16, 16}, {1, 3, 16, 16}},
+        {{1, 3, 16, 16}, {1, 3, 1, 1}, {1, 1, 16, 16}},
+        {{2, 5, 17}, {17}, {2, 5, 1}},
+        {{1, 7, 3, 1}, {1, 7, 3, 1}, {1, 1, 1, 1}},
+        {{1, 2, 3, 4, 5}, {1, 2, 1, 4, 5}, {1, 1, 3, 1, 1}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwise, SnippetsEltwiseTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        SnippetsEltwiseTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
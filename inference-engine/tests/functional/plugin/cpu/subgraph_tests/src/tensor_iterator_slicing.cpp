@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,    // Input shape
+        int64_t,                // Sliced axis
+        int64_t,                // Slicing stride
+        bool,                   // Softmax in the body
+        std::string             // Device name
+> TensorIteratorSlicingTuple;
+
+// TensorIterator iterating over the input chunks and accumulating them in the merged input.
+// Plain Add body lets the CPU plugin alias the chunks or split the batch between several bodies,
+// while Softmax is not known to process the batch elements independently and disables the split.
+class TensorIteratorSlicingTest : public testing::WithParamInterface<TensorIteratorSlicingTuple>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorSlicingTuple> &obj) {
+        std::vector<size_t> inputShape;
+        int64_t axis, stride;
+        bool withSoftmax;
+        std::string targetName;
+        std::tie(inputShape, axis, stride, withSoftmax, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "axis=" << axis << "_";
+        results << "stride=" << stride << "_";
+        results << "body=" << (withSoftmax ? "Add_Softmax" : "Add") << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        int64_t axis, stride;
+        bool withSoftmax;
+        std::tie(inputShape, axis, stride, withSoftmax, targetDevice) = this->GetParam();
+
+        auto chunkShape = inputShape;
+        chunkShape[axis] = 1;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape, chunkShape});
+
+        auto bodyParams = ngraph::builder::makeParams(ngraph::element::f32, {chunkShape, chunkShape});
+        std::shared_ptr<ngraph::Node> bodyOut = std::make_shared<ngraph::opset5::Add>(bodyParams[0], bodyParams[1]);
+        if (withSoftmax)
+            bodyOut = std::make_shared<ngraph::opset5::Softmax>(bodyOut, inputShape.size() - 1);
+        auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{bodyOut}, bodyParams);
+
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+
+        auto tensorIterator = std::make_shared<ngraph::opset5::TensorIterator>();
+        tensorIterator->set_body(body);
+        tensorIterator->set_sliced_input(bodyParams[0], params[0], start, stride, 1, end, axis);
+        tensorIterator->set_merged_input(bodyParams[1], params[1], bodyOut);
+        auto lastValue = tensorIterator->get_iter_value(bodyOut, -1);
+        auto allValues = tensorIterator->get_concatenated_slices(bodyOut, start, stride, 1, end, axis);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset5::Result>(lastValue),
+                                     std::make_shared<ngraph::opset5::Result>(allValues)};
+        function = std::make_shared<ngraph::Function>(results, params, "tensor_iterator_slicing");
+    }
+};
+
+TEST_P(TensorIteratorSlicingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<int64_t> strides = {1, -1};
+
+// the dimensions before the sliced one are 1, so the chunks are aliased without copies
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorSlicing_Aliased, TensorIteratorSlicingTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 10, 16}),
+                                ::testing::Values(1),
+                                ::testing::ValuesIn(strides),
+                                ::testing::Values(false),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        TensorIteratorSlicingTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorSlicing_AliasedInnerAxis, TensorIteratorSlicingTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 1, 10, 16}),
+                                ::testing::Values(2),
+                                ::testing::ValuesIn(strides),
+                                ::testing::Values(false),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        TensorIteratorSlicingTest::getTestCaseName);
+
+// the batch is larger than the number of threads, the Add body is split by the batch, the Softmax one is not
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorSlicing_BatchSplit, TensorIteratorSlicingTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{256, 10, 16}, std::vector<size_t>{255, 5, 8}),
+                                ::testing::Values(1),
+                                ::testing::ValuesIn(strides),
+                                ::testing::Values(false, true),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        TensorIteratorSlicingTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
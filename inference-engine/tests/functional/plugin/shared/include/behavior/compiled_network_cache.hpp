@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include "base/behavior_test_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+namespace BehaviorTestsDefinitions {
+
+class CompiledNetworkCacheTests : public BehaviorTestsUtils::BehaviorTestsBasic {
+public:
+    void SetUp() override {
+        BehaviorTestsUtils::BehaviorTestsBasic::SetUp();
+        cacheDir = "compiled_network_cache_" + std::to_string(reinterpret_cast<std::uintptr_t>(this));
+        // own Core, so the cache statistics are not shared with the other tests
+        core = std::make_shared<InferenceEngine::Core>();
+    }
+
+    void TearDown() override {
+        core.reset();
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+        BehaviorTestsUtils::BehaviorTestsBasic::TearDown();
+    }
+
+protected:
+    unsigned int hits() const {
+        return core->GetMetric(targetDevice, METRIC_KEY(NUMBER_OF_CACHE_HITS)).as<unsigned int>();
+    }
+
+    unsigned int misses() const {
+        return core->GetMetric(targetDevice, METRIC_KEY(NUMBER_OF_CACHE_MISSES)).as<unsigned int>();
+    }
+
+    std::vector<std::string> cachedBlobs() const {
+        std::vector<std::string> files;
+        CommonTestUtils::directoryFileListRecursive(cacheDir, files);
+        return files;
+    }
+
+    std::string cacheDir;
+    std::shared_ptr<InferenceEngine::Core> core;
+};
+
+TEST_P(CompiledNetworkCacheTests, secondLoadIsImportedFromCache) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    InferenceEngine::CNNNetwork cnnNet(function);
+    core->SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+    ASSERT_EQ(cacheDir, core->GetConfig(targetDevice, CONFIG_KEY(CACHE_DIR)).as<std::string>());
+
+    ASSERT_NO_THROW(core->LoadNetwork(cnnNet, targetDevice, configuration));
+    ASSERT_EQ(0u, hits());
+    ASSERT_EQ(1u, misses());
+    ASSERT_EQ(1u, cachedBlobs().size());
+
+    InferenceEngine::ExecutableNetwork execNet;
+    ASSERT_NO_THROW(execNet = core->LoadNetwork(cnnNet, targetDevice, configuration));
+    ASSERT_EQ(1u, hits());
+    ASSERT_EQ(1u, misses());
+
+    InferenceEngine::InferRequest req;
+    ASSERT_NO_THROW(req = execNet.CreateInferRequest());
+    ASSERT_NO_THROW(req.Infer());
+}
+
+TEST_P(CompiledNetworkCacheTests, otherConfigurationIsCacheMiss) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    InferenceEngine::CNNNetwork cnnNet(function);
+    auto config = configuration;
+    config[CONFIG_KEY(CACHE_DIR)] = cacheDir;
+
+    ASSERT_NO_THROW(core->LoadNetwork(cnnNet, targetDevice, config));
+    config[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+    ASSERT_NO_THROW(core->LoadNetwork(cnnNet, targetDevice, config));
+    ASSERT_EQ(0u, hits());
+    ASSERT_EQ(2u, misses());
+    ASSERT_EQ(2u, cachedBlobs().size());
+}
+
+TEST_P(CompiledNetworkCacheTests, corruptedEntryIsRecompiled) {
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    InferenceEngine::CNNNetwork cnnNet(function);
+    core->SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+
+    ASSERT_NO_THROW(core->LoadNetwork(cnnNet, targetDevice, configuration));
+    auto blobs = cachedBlobs();
+    ASSERT_EQ(1u, blobs.size());
+    {
+        std::ofstream blob(blobs.front(), std::ios_base::binary | std::ios_base::trunc);
+        blob << "10\ncorrupted";
+    }
+
+    InferenceEngine::ExecutableNetwork execNet;
+    ASSERT_NO_THROW(execNet = core->LoadNetwork(cnnNet, targetDevice, configuration));
+    ASSERT_EQ(0u, hits());
+    ASSERT_EQ(2u, misses());
+
+    // the entry is written again, so the next load is a hit
+    ASSERT_NO_THROW(core->LoadNetwork(cnnNet, targetDevice, configuration));
+    ASSERT_EQ(1u, hits());
+}
+
+}  // namespace BehaviorTestsDefinitions
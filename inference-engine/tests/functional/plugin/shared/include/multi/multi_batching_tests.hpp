@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+TEST_P(MultiDevice_Test, canInferRequestsCombinedToBatch) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    const std::size_t batchSize = 4;
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {MULTI_CONFIG_KEY(BATCH_SIZE), std::to_string(batchSize)},
+        {MULTI_CONFIG_KEY(BATCH_TIMEOUT), "10"}});
+    auto ref_exec_net = ie->LoadNetwork(net, GetParam().front());
+
+    // one more request than the batch size makes the last batch partially filled
+    std::vector<InferRequest> requests, refRequests;
+    for (std::size_t i = 0; i < batchSize + 1; i++) {
+        requests.push_back(exec_net.CreateInferRequest());
+        refRequests.push_back(ref_exec_net.CreateInferRequest());
+        for (auto&& input : exec_net.GetInputsInfo()) {
+            auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc(), 10, 0, 1, static_cast<int>(i));
+            requests.back().SetBlob(input.first, blob);
+            refRequests.back().SetBlob(input.first, blob);
+        }
+    }
+    for (auto&& request : requests) {
+        ASSERT_NO_THROW(request.StartAsync());
+    }
+    for (std::size_t i = 0; i < requests.size(); i++) {
+        ASSERT_EQ(requests[i].Wait(IInferRequest::RESULT_READY), StatusCode::OK);
+        refRequests[i].Infer();
+        for (auto&& output : exec_net.GetOutputsInfo()) {
+            FuncTestUtils::compareBlobs(requests[i].GetBlob(output.first), refRequests[i].GetBlob(output.first));
+        }
+    }
+}
+
+TEST_P(MultiDevice_Test, canInferPartialBatchAfterFirstBatchIsCompleted) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    // a single worker request per device, so the batches wait for each other
+    std::string devicesWithOneRequest = "MULTI:";
+    for (auto&& device : GetParam()) {
+        devicesWithOneRequest += (device == GetParam().front() ? "" : ",") + device + "(1)";
+    }
+    const std::size_t batchSize = 4;
+    auto exec_net = ie->LoadNetwork(net, devicesWithOneRequest, {
+        {MULTI_CONFIG_KEY(BATCH_SIZE), std::to_string(batchSize)},
+        {MULTI_CONFIG_KEY(BATCH_TIMEOUT), "100"}});
+    auto ref_exec_net = ie->LoadNetwork(net, GetParam().front());
+
+    // two full batches and a partially filled one which is started by the timer after the full ones are completed
+    std::vector<InferRequest> requests, refRequests;
+    for (std::size_t i = 0; i < 2 * batchSize + 1; i++) {
+        requests.push_back(exec_net.CreateInferRequest());
+        refRequests.push_back(ref_exec_net.CreateInferRequest());
+        for (auto&& input : exec_net.GetInputsInfo()) {
+            auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc(), 10, 0, 1, static_cast<int>(i));
+            requests.back().SetBlob(input.first, blob);
+            refRequests.back().SetBlob(input.first, blob);
+        }
+    }
+    for (auto&& request : requests) {
+        ASSERT_NO_THROW(request.StartAsync());
+    }
+    for (std::size_t i = 0; i < requests.size(); i++) {
+        // the timeout is far longer than the batch timeout, so the request is not expected to hang
+        ASSERT_EQ(requests[i].Wait(10000), StatusCode::OK);
+        refRequests[i].Infer();
+        for (auto&& output : exec_net.GetOutputsInfo()) {
+            FuncTestUtils::compareBlobs(requests[i].GetBlob(output.first), refRequests[i].GetBlob(output.first));
+        }
+    }
+
+    // the queue is empty again, the next request is started by the timer too
+    ASSERT_NO_THROW(requests.front().StartAsync());
+    ASSERT_EQ(requests.front().Wait(10000), StatusCode::OK);
+}
+
+TEST_P(MultiDevice_Test, rejectsBlobOfOtherLayoutInBatch) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {MULTI_CONFIG_KEY(BATCH_SIZE), "2"},
+        {MULTI_CONFIG_KEY(BATCH_TIMEOUT), "10"}});
+
+    // the same number of bytes, but the data would be copied to the batch element in the other order
+    auto request = exec_net.CreateInferRequest();
+    auto input = *exec_net.GetInputsInfo().begin();
+    auto desc = input.second->getTensorDesc();
+    ASSERT_EQ(InferenceEngine::Layout::NCHW, desc.getLayout());
+    auto blob = FuncTestUtils::createAndFillBlob({desc.getPrecision(), desc.getDims(), InferenceEngine::Layout::NHWC});
+    request.SetBlob(input.first, blob);
+
+    try {
+        request.StartAsync();
+        request.Wait(IInferRequest::RESULT_READY);
+        FAIL() << "the blob of NHWC layout is not rejected";
+    } catch (const InferenceEngine::details::InferenceEngineException& ex) {
+        ASSERT_NE(std::string{ex.what()}.find("tensor description"), std::string::npos) << ex.what();
+    }
+}
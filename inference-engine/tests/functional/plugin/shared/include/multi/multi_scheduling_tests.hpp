@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+TEST_P(MultiDevice_Test, canScheduleByLatencyAndCollectStatistics) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(SCHEDULE_BY_LATENCY)}});
+
+    const std::size_t numRequests = 8;
+    std::vector<InferRequest> requests;
+    for (std::size_t i = 0; i < numRequests; i++) {
+        requests.push_back(exec_net.CreateInferRequest());
+    }
+    for (auto&& request : requests) {
+        ASSERT_NO_THROW(request.StartAsync());
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(request.Wait(IInferRequest::RESULT_READY), StatusCode::OK);
+    }
+
+    using Statistics = std::map<std::string, std::map<std::string, double>>;
+    Statistics statistics;
+    ASSERT_NO_THROW(statistics = exec_net.GetMetric(METRIC_KEY(DEVICE_SCHEDULING_STATISTICS)).as<Statistics>());
+    double completed = 0;
+    for (auto&& device : GetParam()) {
+        ASSERT_NE(statistics.end(), statistics.find(device));
+        auto& deviceStatistics = statistics.at(device);
+        completed += deviceStatistics.at("COMPLETED_REQUESTS");
+        ASSERT_EQ(0, deviceStatistics.at("REQUESTS_IN_FLIGHT"));
+        if (deviceStatistics.at("COMPLETED_REQUESTS") > 0) {
+            ASSERT_GT(deviceStatistics.at("LATENCY_MS"), 0);
+        }
+    }
+    ASSERT_EQ(numRequests, completed);
+}
@@ -0,0 +1,203 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "runtime/floatmath.h"
+#include "runtime/cnn.h"
+
+namespace {
+
+constexpr float kTolerance = 1e-3f;
+
+std::vector<float> randomVector(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> data(size);
+    for (auto& value : data) {
+        value = dist(gen);
+    }
+    return data;
+}
+
+// C = beta == 1 ? C + A[rows] * B : A[rows] * B, the naive loops of the reference implementation
+std::vector<float> referenceGemm(size_t L, size_t N, size_t K, const std::vector<float>& A, const std::vector<uint32_t>& rows,
+                                 const std::vector<float>& B, std::vector<float> C, float beta) {
+    for (size_t l = 0; l < L; l++) {
+        const size_t i = rows.empty() ? l : rows[l];
+        for (size_t j = 0; j < N; j++) {
+            float sum = beta == 1.f ? C[l * N + j] : 0.f;
+            for (size_t k = 0; k < K; k++) {
+                sum += A[i * K + k] * B[k * N + j];
+            }
+            C[l * N + j] = sum;
+        }
+    }
+    return C;
+}
+
+}  // namespace
+
+class GNAFloatMathTest : public ::testing::Test {};
+
+TEST_F(GNAFloatMathTest, dotProductsMatchReference) {
+    for (size_t k : {0, 1, 7, 8, 15, 16, 17, 31, 32, 33, 100, 1025}) {
+        const auto a = randomVector(k, 1);
+        const auto b = randomVector(GNAPluginNS::runtime::kMaxDotProducts * (k + 3), 2);
+        for (size_t num_b = 1; num_b <= GNAPluginNS::runtime::kMaxDotProducts; num_b++) {
+            float sums[GNAPluginNS::runtime::kMaxDotProducts] = {};
+            GNAPluginNS::runtime::DotProducts(a.data(), b.data(), k + 3, num_b, k, sums);
+            for (size_t j = 0; j < num_b; j++) {
+                float ref = 0.f;
+                for (size_t i = 0; i < k; i++) {
+                    ref += a[i] * b[j * (k + 3) + i];
+                }
+                ASSERT_NEAR(ref, sums[j], kTolerance) << "k = " << k << ", product " << j;
+            }
+        }
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmMatchesReference) {
+    // the last shapes are big enough to be computed in parallel and blocked over K
+    for (auto shape : std::vector<std::array<size_t, 3>>{{5, 1, 3}, {7, 3, 33}, {37, 8, 1100}, {300, 2, 600}}) {
+        const size_t M = shape[0], N = shape[1], K = shape[2];
+        const auto A = randomVector(M * K, 3);
+        const auto B = randomVector(K * N, 4);
+        const auto C0 = randomVector(M * N, 5);
+        for (float beta : {1.f, 0.f}) {
+            auto C = C0;
+            cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, beta, C.data(), N);
+            const auto ref = referenceGemm(M, N, K, A, {}, B, C0, beta);
+            for (size_t i = 0; i < C.size(); i++) {
+                ASSERT_NEAR(ref[i], C[i], kTolerance) << "M = " << M << ", N = " << N << ", K = " << K << ", index " << i;
+            }
+        }
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmSubsetMatchesReference) {
+    const size_t M = 64, N = 4, K = 257;
+    const std::vector<uint32_t> rows = {63, 0, 17, 17, 5, 42, 1};
+    const auto A = randomVector(M * K, 6);
+    const auto B = randomVector(K * N, 7);
+    const auto C0 = randomVector(rows.size() * N, 8);
+
+    auto C = C0;
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N,
+                       rows.data(), rows.size());
+    const auto ref = referenceGemm(rows.size(), N, K, A, rows, B, C0, 1.f);
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(ref[i], C[i], kTolerance) << "index " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemvSplitMatchesReference) {
+    const uint32_t N = 67, K1 = 45, K2 = 19;
+    const auto A1 = randomVector(K1, 9);
+    const auto A2 = randomVector(K2, 10);
+    const auto X = randomVector(N * (K1 + K2), 11);
+    const auto B = randomVector(N, 12);
+    std::vector<float> C(N);
+
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+    for (uint32_t i = 0; i < N; i++) {
+        float ref = B[i];
+        for (uint32_t j = 0; j < K1; j++) {
+            ref += A1[j] * X[i * (K1 + K2) + j];
+        }
+        for (uint32_t j = 0; j < K2; j++) {
+            ref += A2[j] * X[i * (K1 + K2) + K1 + j];
+        }
+        ASSERT_NEAR(ref, C[i], kTolerance) << "row " << i;
+    }
+}
+
+TEST_F(GNAFloatMathTest, convolution1DMatchesReference) {
+    const uint32_t numFilters = 7, numCoefficients = 24, numFeatureMaps = 2, numFeatureMapColumns = 4, numFeatureMapRows = 10;
+    const uint32_t numFilterRows = numCoefficients / (numFeatureMaps * numFeatureMapColumns);
+    const uint32_t numOutputs = numFeatureMapRows - numFilterRows + 1;
+    auto filters = randomVector(numFilters * numCoefficients, 13);
+    auto biases = randomVector(numFilters, 14);
+    auto inputs = randomVector(numFeatureMapRows * numFeatureMaps * numFeatureMapColumns, 15);
+    std::vector<float> outputs(numOutputs * numFilters);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_out = numOutputs * numFilters;
+    component.op.conv1D.num_filters = numFilters;
+    component.op.conv1D.num_filter_rows = numFilterRows;
+    component.op.conv1D.num_filter_coefficients = numCoefficients;
+    component.op.conv1D.num_feature_maps = numFeatureMaps;
+    component.op.conv1D.num_feature_map_rows = numFeatureMapRows;
+    component.op.conv1D.num_feature_map_columns = numFeatureMapColumns;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    component.original_layer_name = "conv1d";
+    CNNFilter32(&component);
+
+    for (uint32_t j = 0; j < numOutputs; j++) {
+        for (uint32_t i = 0; i < numFilters; i++) {
+            float ref = biases[i];
+            for (uint32_t k = 0; k < numCoefficients; k++) {
+                ref += inputs[j * numFeatureMaps * numFeatureMapColumns + k] * filters[i * numCoefficients + k];
+            }
+            ASSERT_NEAR(ref, outputs[j * numFilters + i], kTolerance) << "output " << j << ", filter " << i;
+        }
+    }
+}
+
+#if GNA_LIB_VER == 2
+TEST_F(GNAFloatMathTest, convolution2DMatchesReference) {
+    const uint32_t IH = 6, IW = 7, IC = 3, KN = 5, KH = 3, KW = 2;
+    const std::array<uint32_t, 2> stride = {2, 1}, padding = {1, 1};
+    const uint32_t OH = (IH + 2 * padding[0] - KH) / stride[0] + 1;
+    const uint32_t OW = (IW + 2 * padding[1] - KW) / stride[1] + 1;
+    // kernels are padded to 4 floats
+    const uint32_t kernelStride = (KH * KW * IC + 3) / 4 * 4;
+    auto filters = randomVector(KN * kernelStride, 16);
+    auto biases = randomVector(KN, 17);
+    auto inputs = randomVector(IH * IW * IC, 18);
+    std::vector<float> outputs(OH * OW * KN);
+
+    intel_dnn_component_t component{};
+    component.tensors = {{{1, IH, IW, IC}}, {{1, OH, OW, KN}}, {{KN, KH, KW, IC}}};
+    component.op.conv2D.convStride = stride;
+    component.op.conv2D.zeroPadding = padding;
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    component.original_layer_name = "conv2d";
+    CNN2DFilter32(&component);
+
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < KN; oc++) {
+                float ref = biases[oc];
+                for (uint32_t kh = 0; kh < KH; kh++) {
+                    for (uint32_t kw = 0; kw < KW; kw++) {
+                        const int ih = static_cast<int>(oh * stride[0] + kh) - static_cast<int>(padding[0]);
+                        const int iw = static_cast<int>(ow * stride[1] + kw) - static_cast<int>(padding[1]);
+                        if (ih < 0 || iw < 0 || ih >= static_cast<int>(IH) || iw >= static_cast<int>(IW)) {
+                            continue;
+                        }
+                        for (uint32_t ic = 0; ic < IC; ic++) {
+                            ref += inputs[(ih * IW + iw) * IC + ic] * filters[oc * kernelStride + (kh * KW + kw) * IC + ic];
+                        }
+                    }
+                }
+                ASSERT_NEAR(ref, outputs[(oh * OW + ow) * KN + oc], kTolerance) << "oh " << oh << ", ow " << ow << ", oc " << oc;
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,100 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "common_test_utils/test_common.hpp"
+
+#include "compilation_context.hpp"
+#include "ie_cache_manager.hpp"
+
+using namespace InferenceEngine;
+
+class CompilationContextTests : public CommonTestUtils::TestsCommon {
+protected:
+    static CNNNetwork createNetwork(float constValue = 1.f) {
+        auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 8, 8});
+        param->set_friendly_name("input");
+        auto constant = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {constValue});
+        auto add = std::make_shared<ngraph::opset5::Add>(param, constant);
+        auto relu = std::make_shared<ngraph::opset5::Relu>(add);
+        auto result = std::make_shared<ngraph::opset5::Result>(relu);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                             ngraph::ParameterVector{param}));
+    }
+};
+
+TEST_F(CompilationContextTests, hashIsStableForEqualNetworks) {
+    auto hash1 = details::computeNetworkHash(createNetwork(), {{"KEY", "VALUE"}});
+    auto hash2 = details::computeNetworkHash(createNetwork(), {{"KEY", "VALUE"}});
+    ASSERT_FALSE(hash1.empty());
+    EXPECT_EQ(hash1, hash2);
+}
+
+TEST_F(CompilationContextTests, hashDependsOnWeights) {
+    EXPECT_NE(details::computeNetworkHash(createNetwork(1.f), {}),
+              details::computeNetworkHash(createNetwork(2.f), {}));
+}
+
+TEST_F(CompilationContextTests, hashDependsOnCompileOptions) {
+    EXPECT_NE(details::computeNetworkHash(createNetwork(), {{"KEY", "VALUE1"}}),
+              details::computeNetworkHash(createNetwork(), {{"KEY", "VALUE2"}}));
+}
+
+TEST_F(CompilationContextTests, hashDependsOnInputsInfo) {
+    auto network = createNetwork();
+    auto hash1 = details::computeNetworkHash(network, {});
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    auto hash2 = details::computeNetworkHash(network, {});
+    network.getInputsInfo().begin()->second->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+    auto hash3 = details::computeNetworkHash(network, {});
+    EXPECT_NE(hash1, hash2);
+    EXPECT_NE(hash2, hash3);
+}
+
+class FileStorageCacheManagerTests : public CommonTestUtils::TestsCommon {
+protected:
+    std::string cacheDir = "FileStorageCacheManagerTests";
+
+    void TearDown() override {
+        std::remove(FileUtils::makePath(cacheDir, std::string("id.blob")).c_str());
+        std::remove(cacheDir.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, canWriteReadAndRemoveEntry) {
+    FileStorageCacheManager cacheManager(cacheDir);
+    cacheManager.writeCacheEntry("id", [](std::ostream& stream) {
+        stream << "compiled network";
+    });
+
+    std::string content;
+    EXPECT_TRUE(cacheManager.readCacheEntry("id", [&](std::istream& stream) {
+        std::getline(stream, content);
+    }));
+    EXPECT_EQ("compiled network", content);
+
+    cacheManager.removeCacheEntry("id");
+    EXPECT_FALSE(cacheManager.readCacheEntry("id", [](std::istream&) {
+        FAIL() << "Reader must not be called for a removed entry";
+    }));
+}
+
+TEST_F(FileStorageCacheManagerTests, failedWriterDoesNotCreateEntry) {
+    FileStorageCacheManager cacheManager(cacheDir);
+    EXPECT_ANY_THROW(cacheManager.writeCacheEntry("id", [](std::ostream& stream) {
+        stream << "partial";
+        THROW_IE_EXCEPTION << "Export failed";
+    }));
+    EXPECT_FALSE(cacheManager.readCacheEntry("id", [](std::istream&) {}));
+}
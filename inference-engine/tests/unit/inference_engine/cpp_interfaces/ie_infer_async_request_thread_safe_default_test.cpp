@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdio>
 #include <deque>
+#include <fstream>
+#include <sstream>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -11,6 +14,7 @@
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <ie_tracer.hpp>
 
 #include "unit_test_utils/mocks/cpp_interfaces/mock_task_executor.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/impl/mock_infer_request_internal.hpp"
@@ -244,3 +248,38 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, closesTraceEventOfRequestIfTracingIsSwitchedDuringInference) {
+    const std::string path = "infer_request_switched_trace.json";
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(2)
+        .WillOnce(Invoke([&] { EnableTracing(path); }))
+        .WillOnce(Invoke([] { DisableTracing(); }));
+
+    // not traced as tracing is disabled at the start
+    DisableTracing();
+    testRequest->StartAsync();
+    testRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+    ASSERT_TRUE(IsTracingEnabled());
+    // traced till the end, while tracing is disabled in the middle
+    testRequest->StartAsync();
+    testRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+    ASSERT_FALSE(IsTracingEnabled());
+
+    FlushTrace();
+    std::stringstream trace;
+    trace << std::ifstream(path).rdbuf();
+    std::remove(path.c_str());
+    auto count = [&](const std::string& event) {
+        std::size_t occurrences = 0;
+        const auto str = trace.str();
+        for (auto pos = str.find(event); pos != std::string::npos; pos = str.find(event, pos + event.size())) {
+            ++occurrences;
+        }
+        return occurrences;
+    };
+    ASSERT_EQ(1u, count("\"name\":\"request\",\"cat\":\"pipeline\",\"ph\":\"b\""));
+    ASSERT_EQ(1u, count("\"name\":\"request\",\"cat\":\"pipeline\",\"ph\":\"e\""));
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_blob.h>
+#include "common_test_utils/test_common.hpp"
+
+#include "mmap_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class MmapAllocatorTests : public CommonTestUtils::TestsCommon {
+protected:
+    std::string fileName = "MmapAllocatorTests.bin";
+    std::vector<uint8_t> content;
+
+    void SetUp() override {
+        CommonTestUtils::TestsCommon::SetUp();
+        content.resize(10000);
+        for (size_t i = 0; i < content.size(); i++) {
+            content[i] = static_cast<uint8_t>(i % 251);
+        }
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(content.data()), content.size());
+    }
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+        CommonTestUtils::TestsCommon::TearDown();
+    }
+};
+
+#ifndef _WIN32
+
+TEST_F(MmapAllocatorTests, canMapFileContent) {
+    auto allocator = details::make_mmap_allocator(fileName);
+    ASSERT_NE(nullptr, allocator);
+
+    void* handle = allocator->alloc(content.size());
+    ASSERT_NE(nullptr, handle);
+    auto ptr = static_cast<const uint8_t*>(allocator->lock(handle, LOCK_FOR_READ));
+    EXPECT_EQ(0, std::memcmp(ptr, content.data(), content.size()));
+    allocator->unlock(handle);
+    EXPECT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    auto allocator = details::make_mmap_allocator(fileName);
+    ASSERT_NE(nullptr, allocator);
+    EXPECT_EQ(nullptr, allocator->alloc(content.size() + 1));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMissingFile) {
+    auto allocator = details::make_mmap_allocator(fileName + ".missing");
+    ASSERT_NE(nullptr, allocator);
+    EXPECT_EQ(nullptr, allocator->alloc(1));
+}
+
+TEST_F(MmapAllocatorTests, blobKeepsMappingAlive) {
+    Blob::Ptr blob;
+    {
+        auto allocator = details::make_mmap_allocator(fileName);
+        blob = make_shared_blob<uint8_t>({ Precision::U8, { content.size() }, C }, allocator);
+        blob->allocate();
+    }
+    auto ptr = blob->cbuffer().as<const uint8_t*>();
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(content.back(), ptr[content.size() - 1]);
+}
+
+#else
+
+TEST_F(MmapAllocatorTests, isNotSupported) {
+    EXPECT_EQ(nullptr, details::make_mmap_allocator(fileName));
+}
+
+#endif
@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "multi_device_scheduling.hpp"
+
+using namespace MultiDevicePlugin;
+
+namespace {
+
+DeviceLoad makeLoad(std::size_t numRequests, std::uint64_t pending, std::uint64_t latencyUs) {
+    DeviceLoad load;
+    load.numRequests = numRequests;
+    load.pending = pending;
+    load.latencyUs = latencyUs;
+    return load;
+}
+
+// dispatches the requests one by one without completions, returns the number of requests per device
+std::vector<std::size_t> dispatch(std::vector<DeviceLoad> loads, std::size_t numRequests) {
+    std::vector<std::size_t> dispatched(loads.size(), 0);
+    for (std::size_t i = 0; i < numRequests; i++) {
+        const auto selected = SelectDeviceByLatency(loads);
+        if (selected == loads.size())
+            break;
+        loads[selected].pending++;
+        dispatched[selected]++;
+    }
+    return dispatched;
+}
+
+}  // namespace
+
+TEST(MultiDeviceSchedulingTests, fasterDeviceIsPreferred) {
+    // the slow device has the higher priority
+    ASSERT_EQ(1u, SelectDeviceByLatency({makeLoad(4, 0, 10000), makeLoad(4, 0, 1000)}));
+}
+
+TEST(MultiDeviceSchedulingTests, fasterDeviceGetsMostOfTheRequests) {
+    const auto dispatched = dispatch({makeLoad(4, 0, 4000), makeLoad(4, 0, 1000)}, 32);
+    ASSERT_EQ(32u, dispatched[0] + dispatched[1]);
+    ASSERT_GT(dispatched[1], 3 * dispatched[0]);
+    // the slow device still takes a part of the queue once the fast one is loaded enough
+    ASSERT_GT(dispatched[0], 0u);
+}
+
+TEST(MultiDeviceSchedulingTests, requestsInFlightAreTakenIntoAccount) {
+    // 8 requests ahead of the new one on the fast device: 1000 * (1 + 5 / 4) > 2000
+    ASSERT_EQ(0u, SelectDeviceByLatency({makeLoad(4, 0, 2000), makeLoad(4, 8, 1000)}));
+    ASSERT_EQ(1u, SelectDeviceByLatency({makeLoad(4, 0, 2000), makeLoad(4, 3, 1000)}));
+}
+
+TEST(MultiDeviceSchedulingTests, higherPriorityWinsOnEqualTimes) {
+    ASSERT_EQ(0u, SelectDeviceByLatency({makeLoad(2, 0, 1000), makeLoad(2, 0, 1000)}));
+}
+
+TEST(MultiDeviceSchedulingTests, deviceWithoutLatencyIsTriedWhileItHasIdleRequests) {
+    ASSERT_EQ(1u, SelectDeviceByLatency({makeLoad(4, 0, 1000), makeLoad(2, 1, 0)}));
+    ASSERT_EQ(0u, SelectDeviceByLatency({makeLoad(4, 0, 1000), makeLoad(2, 2, 0)}));
+}
+
+TEST(MultiDeviceSchedulingTests, noDeviceIsSelectedWhenUntriedDevicesAreBusy) {
+    ASSERT_EQ(2u, SelectDeviceByLatency({makeLoad(1, 1, 0), makeLoad(2, 2, 0)}));
+}
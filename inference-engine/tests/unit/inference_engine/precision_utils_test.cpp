@@ -6,7 +6,15 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
 #include <limits>
+#include <random>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +54,151 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+namespace {
+
+uint32_t asUInt(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float asFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// special values followed by random bit patterns, the array size isn't a multiple of a vector length
+std::vector<float> makeF32TestValues(size_t size) {
+    std::vector<float> values = {
+        0.f, -0.f, 1.f, -1.f, 0.5f, 65504.f, 65519.f, 65520.f, -65520.f, 1e10f, -1e10f,
+        asFloat(0x387FC000), asFloat(0x38000000), asFloat(0x37FFFFFF), asFloat(0x33800000), asFloat(0x00000001),
+        std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::min(),
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(), asFloat(0x7F800001), asFloat(0xFFC01234), asFloat(0x7FFFFFFF)
+    };
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> bits;
+    std::uniform_real_distribution<float> inRange(-70000.f, 70000.f);
+    while (values.size() < size) {
+        values.push_back(asFloat(bits(gen)));
+        values.push_back(inRange(gen));
+    }
+    values.resize(size);
+    return values;
+}
+
+}  // namespace
+
+TEST_F(PrecisionUtilsTests, FP16ToFP32ArraysMatchScalarForAllValues) {
+    std::vector<ie_fp16> src(1 << 16);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(asUInt(PrecisionUtils::f16tof32(src[i])), asUInt(dst[i])) << "f16 value 0x" << std::hex << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToFP16ArraysMatchScalar) {
+    // large enough to be converted in parallel
+    const auto src = makeF32TestValues((1 << 17) + 7);
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i]), dst[i]) << "f32 value 0x" << std::hex << asUInt(src[i]);
+    }
+}
+
+TEST_F(PrecisionUtilsTests, BF16ToFP32ArraysMatchScalar) {
+    std::vector<ie_bf16> src(1 << 16);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_bf16>(i);
+    }
+    std::vector<float> dst(src.size());
+    PrecisionUtils::bf16tof32Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(static_cast<uint32_t>(i) << 16, asUInt(dst[i]));
+        ASSERT_EQ(asUInt(PrecisionUtils::bf16tof32(src[i])), asUInt(dst[i]));
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToBF16ArraysMatchScalar) {
+    const auto src = makeF32TestValues((1 << 17) + 7);
+    std::vector<ie_bf16> dst(src.size());
+    PrecisionUtils::f32tobf16Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(PrecisionUtils::f32tobf16(src[i]), dst[i]) << "f32 value 0x" << std::hex << asUInt(src[i]);
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToBF16RoundsTiesToEven) {
+    ASSERT_EQ(static_cast<ie_bf16>(0x3F80), PrecisionUtils::f32tobf16(1.f));
+    ASSERT_EQ(static_cast<ie_bf16>(0x3F80), PrecisionUtils::f32tobf16(asFloat(0x3F808000)));
+    ASSERT_EQ(static_cast<ie_bf16>(0x3F82), PrecisionUtils::f32tobf16(asFloat(0x3F818000)));
+    ASSERT_EQ(static_cast<ie_bf16>(0xFF80), PrecisionUtils::f32tobf16(-std::numeric_limits<float>::infinity()));
+}
+
+TEST_F(PrecisionUtilsTests, ArraysApplyScaleAndBias) {
+    const float scale = 0.5f, bias = -3.f;
+    std::vector<float> src(1001);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<float>(i) - 500.f;
+    }
+
+    std::vector<ie_fp16> f16(src.size());
+    std::vector<ie_bf16> bf16(src.size());
+    PrecisionUtils::f32tof16Arrays(f16.data(), src.data(), src.size(), scale, bias);
+    PrecisionUtils::f32tobf16Arrays(bf16.data(), src.data(), src.size(), scale, bias);
+
+    std::vector<float> fromF16(src.size()), fromBF16(src.size());
+    PrecisionUtils::f16tof32Arrays(fromF16.data(), f16.data(), f16.size(), 2.f, 1.f);
+    PrecisionUtils::bf16tof32Arrays(fromBF16.data(), bf16.data(), bf16.size(), 2.f, 1.f);
+
+    for (size_t i = 0; i < src.size(); i++) {
+        // the values are exact in f16, bf16 keeps 8 significant bits
+        ASSERT_EQ(src[i] * scale + bias, PrecisionUtils::f16tof32(f16[i]));
+        ASSERT_EQ(src[i] - 5.f, fromF16[i]);
+        ASSERT_NEAR(src[i] - 5.f, fromBF16[i], std::fabs(src[i]) / 128.f + 1.f);
+    }
+}
+
+// Micro-benchmark of the dispatched conversions against the scalar loops,
+// run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+TEST_F(PrecisionUtilsTests, DISABLED_ArraysBenchmark) {
+    const size_t size = 1 << 22;
+    const int iterations = 20;
+    const auto src = makeF32TestValues(size);
+    std::vector<ie_fp16> f16(size);
+    std::vector<float> f32(size);
+
+    auto measure = [&](const char* name, const std::function<void()>& func) {
+        func();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            func();
+        }
+        const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << time.count() / iterations << " ms" << std::endl;
+    };
+
+    measure("scalar f32 -> f16", [&] {
+        for (size_t i = 0; i < size; i++) {
+            f16[i] = PrecisionUtils::f32tof16(src[i]);
+        }
+    });
+    measure("f32tof16Arrays", [&] { PrecisionUtils::f32tof16Arrays(f16.data(), src.data(), size); });
+    measure("scalar f16 -> f32", [&] {
+        for (size_t i = 0; i < size; i++) {
+            f32[i] = PrecisionUtils::f16tof32(f16[i]);
+        }
+    });
+    measure("f16tof32Arrays", [&] { PrecisionUtils::f16tof32Arrays(f32.data(), f16.data(), size); });
+}
@@ -0,0 +1,161 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <ie_parallel.hpp>
+
+#include <vpu/middleend/hw/tiling.hpp>
+#include <vpu/middleend/hw/utility.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace vpu {
+
+namespace ie = InferenceEngine;
+
+class HwConvTilingTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+        ASSERT_NO_FATAL_FAILURE(InitPipeline());
+    }
+
+    void InitPipeline() {
+        _pipeline = PassSet();
+        _pipeline.addPass(passManager->dumpModel("before-hw-conv-tiling"));
+        _pipeline.addPass(passManager->hwConvTiling());
+        _pipeline.addPass(passManager->dumpModel("after-hw-conv-tiling"));
+    }
+
+    // Independent convolutions of the same input, so the tiling search runs for several stages at once
+    Model CreateModelWithConvolutions(const std::vector<int>& outputChannels) {
+        const int inputSize = 56;
+        const int inputChannels = 64;
+        const int kernelSize = 3;
+
+        auto model = CreateModel();
+
+        auto input = model->addInputData(
+            "Input",
+            DataDesc(DataType::FP16, DimsOrder::NCHW, {inputSize, inputSize, inputChannels, 1}));
+        model->attrs().set<int>("numInputs", 1);
+
+        for (size_t convInd = 0; convInd < outputChannels.size(); ++convInd) {
+            const auto convName = "conv" + std::to_string(convInd);
+
+            auto output = model->addOutputData(
+                "Output" + std::to_string(convInd),
+                DataDesc(DataType::FP16, DimsOrder::NCHW, {inputSize, inputSize, outputChannels[convInd], 1}));
+
+            auto conv = std::make_shared<ie::ConvolutionLayer>(ie::LayerParams{convName, "Convolution", ie::Precision::FP16});
+            conv->_kernel_x = kernelSize;
+            conv->_kernel_y = kernelSize;
+            conv->_stride_x = 1;
+            conv->_stride_y = 1;
+            conv->_dilation_x = 1;
+            conv->_dilation_y = 1;
+            conv->_out_depth = outputChannels[convInd];
+
+            conv->_padding.insert(0, 1);
+            conv->_padding.insert(1, 1);
+            conv->_pads_end.insert(0, 1);
+            conv->_pads_end.insert(1, 1);
+
+            conv->_weights = ie::make_shared_blob<short>({
+                ie::Precision::FP16,
+                {static_cast<size_t>(kernelSize * kernelSize * inputChannels * outputChannels[convInd])},
+                ie::Layout::C});
+            conv->_weights->allocate();
+
+            frontEnd->parseConvolution(model, conv, {input}, {output});
+        }
+
+        return model;
+    }
+
+    // Runs the pipeline with a single thread, so the tiling search is done sequentially
+    void RunSequentially(const Model& model) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+        tbb::task_arena arena(1);
+        arena.execute([&] {
+            ASSERT_EQ(1, parallel_get_max_threads());
+            ASSERT_NO_THROW(_pipeline.run(model));
+        });
+#elif IE_THREAD == IE_THREAD_OMP
+        const int maxThreads = parallel_get_max_threads();
+        parallel_set_num_threads(1);
+        EXPECT_NO_THROW(_pipeline.run(model));
+        parallel_set_num_threads(maxThreads);
+#else
+        ASSERT_NO_THROW(_pipeline.run(model));
+#endif
+    }
+
+    // The stages in the execution order with their data and the HW operation parameters chosen by the tiling
+    static std::vector<std::string> tilingSummary(const Model& model) {
+        std::vector<std::string> summary;
+        for (const auto& stage : model->getStages()) {
+            std::ostringstream stageSummary;
+            stageSummary << stage->name() << " " << toString(stage->type());
+            for (const auto& input : stage->inputs()) {
+                stageSummary << " in " << input->name() << toString(input->desc().dims());
+            }
+            for (const auto& output : stage->outputs()) {
+                stageSummary << " out " << output->name() << toString(output->desc().dims());
+            }
+
+            if (stage->type() == StageType::MyriadXHwOp) {
+                const auto& attrs = stage->attrs();
+                stageSummary << " " << toString(attrs.get<HwOpType>("hwOpType"))
+                             << " kernel " << attrs.get<int>("kernelSizeX") << "x" << attrs.get<int>("kernelSizeY")
+                             << " stride " << attrs.get<int>("kernelStride")
+                             << " pad " << toString(attrs.get<HwPaddingInfo>("pad"))
+                             << " tiling " << toString(attrs.get<HwConvTileInfo>("tiling"));
+            }
+
+            summary.push_back(stageSummary.str());
+        }
+        return summary;
+    }
+
+protected:
+    PassSet _pipeline;
+};
+
+TEST_F(HwConvTilingTests, TilesAllConvolutions) {
+    auto model = CreateModelWithConvolutions({16, 64, 128, 512});
+    ASSERT_NO_THROW(_pipeline.run(model));
+
+    int numHwStages = 0;
+    for (const auto& stage : model->getStages()) {
+        ASSERT_NE(stage->type(), StageType::StubConv) << stage->name();
+        if (stage->type() == StageType::MyriadXHwOp) {
+            ++numHwStages;
+        }
+    }
+    ASSERT_GE(numHwStages, 4);
+}
+
+TEST_F(HwConvTilingTests, ParallelSearchMatchesSequential) {
+    const std::vector<int> outputChannels{16, 64, 128, 512, 32, 256};
+
+    auto sequentialModel = CreateModelWithConvolutions(outputChannels);
+    ASSERT_NO_FATAL_FAILURE(RunSequentially(sequentialModel));
+
+    auto parallelModel = CreateModelWithConvolutions(outputChannels);
+    ASSERT_NO_THROW(_pipeline.run(parallelModel));
+
+    const auto sequentialSummary = tilingSummary(sequentialModel);
+    const auto parallelSummary = tilingSummary(parallelModel);
+    ASSERT_EQ(sequentialSummary.size(), parallelSummary.size());
+    for (size_t stageInd = 0; stageInd < sequentialSummary.size(); ++stageInd) {
+        ASSERT_EQ(sequentialSummary[stageInd], parallelSummary[stageInd]) << "stage #" << stageInd;
+    }
+}
+
+}  // namespace vpu
@@ -9,6 +9,7 @@
 #include "ie_preprocess.hpp"
 #include "ie_preprocess_data.hpp"
 #include "ie_compound_blob.h"
+#include "ie_tracer.hpp"
 
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
@@ -21,7 +22,9 @@
 
 #include <chrono>
 
+#include <fstream>
 #include <map>
+#include <sstream>
 
 #include <stdexcept>
 
@@ -659,6 +662,37 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
         EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
     }
 }
+
+TEST_P(NormalizeTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    float mean        = std::get<1>(params).first;
+    float scale       = std::get<1>(params).second;
+    cv::Size sz       = std::get<2>(params);
+    double tolerance  = std::get<3>(params);
+
+    initMatrixRandU(CV_MAKETYPE(in_depth,1), sz, CV_32FC1);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    NormalizeComputation cc(to_test(in_mat1), to_test(out_mat_gapi), mean, scale);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+        400, "Normalize GAPI %s to F32 %dx%d", depthToString(in_mat1.depth()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        in_mat1.convertTo(out_mat_ocv, CV_32FC1, scale, -mean * scale);
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
 //----------------------------------------------------------------------
 
 TEST_P(ResizeTestIE, AccuracyTest)
@@ -735,6 +769,77 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+namespace {
+// number of the preprocessing graph cache events of the kind recorded by the tracer so far
+size_t countCacheEvents(const std::string& tracePath, const std::string& kind) {
+    InferenceEngine::FlushTrace();
+    std::ifstream file(tracePath);
+    std::stringstream trace;
+    trace << file.rdbuf();
+    const std::string event = "\"name\":\"graph cache " + kind + "\",\"cat\":\"preprocessing\"";
+    const std::string content = trace.str();
+    size_t count = 0;
+    for (auto pos = content.find(event); pos != std::string::npos; pos = content.find(event, pos + event.size()))
+        count++;
+    return count;
+}
+}  // namespace
+
+TEST_P(ResizeAlternatingSizesTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    std::pair<cv::Size, cv::Size> sizes_in;
+    cv::Size sz_out;
+    double tolerance = 0.0;
+    std::tie(type, interp, sizes_in, sz_out, tolerance) = GetParam();
+
+    using namespace InferenceEngine;
+
+    const size_t channels = CV_MAT_CN(type);
+    const Precision precision = CV_8U == CV_MAT_DEPTH(type) ? Precision::U8 : Precision::FP32;
+
+    cv::Mat out_mat(sz_out, type);
+    cv::Mat out_mat_ocv(sz_out, type);
+    Blob::Ptr out_blob = make_blob_with_precision(
+        TensorDesc(precision, {1, channels, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width)}, Layout::NHWC),
+        out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    PreProcessInfo info;
+    info.setResizeAlgorithm(cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR);
+
+    const std::string tracePath = "fluid_preproc_graph_cache_trace.json";
+    EnableTracing(tracePath);
+    const auto hits = countCacheEvents(tracePath, "hit");
+    const auto reshapes = countCacheEvents(tracePath, "miss reshape");
+    const auto rebuilds = countCacheEvents(tracePath, "miss rebuild");
+
+    const int calls = 6;
+    for (int i = 0; i < calls; i++) {
+        const cv::Size sz_in = i % 2 == 0 ? sizes_in.first : sizes_in.second;
+        cv::Mat in_mat(sz_in, type);
+        cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+        Blob::Ptr in_blob = make_blob_with_precision(
+            TensorDesc(precision, {1, channels, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width)}, Layout::NHWC),
+            in_mat.data);
+        preprocess->setRoiBlob(in_blob);
+        preprocess->execute(out_blob, info, false);
+
+        cv::resize(in_mat, out_mat_ocv, sz_out, 0, 0, interp);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance) << "call " << i;
+    }
+
+    // the first size gets new graphs, which are reshaped for the second one. The first size is
+    // seen again, so it gets graphs of its own, and both sizes hit the cache after that
+    EXPECT_EQ(2u, countCacheEvents(tracePath, "miss rebuild") - rebuilds);
+    EXPECT_EQ(1u, countCacheEvents(tracePath, "miss reshape") - reshapes);
+    EXPECT_EQ(static_cast<size_t>(calls - 3), countCacheEvents(tracePath, "hit") - hits);
+
+    DisableTracing();
+    std::remove(tracePath.c_str());
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
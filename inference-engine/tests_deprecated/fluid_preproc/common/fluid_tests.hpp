@@ -25,9 +25,22 @@ struct ConvertDepthTestGAPI: public TestParams<std::tuple<
                             cv::Size,
                             double>>   // tolerance
 {};
+struct NormalizeTestGAPI: public TestParams<std::tuple<
+                            int,  // input matrix depth
+                            std::pair<float, float>,  // mean and scale
+                            cv::Size,
+                            double>>   // tolerance
+{};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct ResizeAlternatingSizesTestIE: public testing::TestWithParam<std::tuple<
+                            int,  // matrix type
+                            int,  // interpolation
+                            std::pair<cv::Size, cv::Size>,  // input sizes used in turn
+                            cv::Size,  // output size
+                            double>>   // tolerance
+{};
 
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
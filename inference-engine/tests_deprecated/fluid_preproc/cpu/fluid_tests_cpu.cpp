@@ -183,6 +183,16 @@ INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(1)));
 
+INSTANTIATE_TEST_CASE_P(NormalizeFluid, NormalizeTestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(std::make_pair(0.f, 1.f),
+                                       std::make_pair(123.68f, 0.017f)),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 300,  300),
+                                       cv::Size( 320,  200)),
+                                Values(1e-4)));
+
 INSTANTIATE_TEST_CASE_P(ResizeRoiTestFluid, ResizeRoiTestGAPI,
                         Combine(Values(CV_8UC1, CV_8UC3),
                                 Values(cv::INTER_LINEAR),
@@ -225,6 +235,30 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+// the sizes are not used by the other tests, so the graphs are not in the cache yet
+#if defined(__arm__) || defined(__aarch64__)
+INSTANTIATE_TEST_CASE_P(ResizeAlternatingSizesTestFluid_U8, ResizeAlternatingSizesTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(std::make_pair(cv::Size(97, 83), cv::Size(131, 101))),
+                                Values(cv::Size(53, 41)),
+                                Values(4))); // error not more than 4 unit
+#else
+INSTANTIATE_TEST_CASE_P(ResizeAlternatingSizesTestFluid_U8, ResizeAlternatingSizesTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(std::make_pair(cv::Size(97, 83), cv::Size(131, 101))),
+                                Values(cv::Size(53, 41)),
+                                Values(1))); // error not more than 1 unit
+#endif
+
+INSTANTIATE_TEST_CASE_P(ResizeAlternatingSizesTestFluid_F32, ResizeAlternatingSizesTestIE,
+                        Combine(Values(CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(std::make_pair(cv::Size(97, 83), cv::Size(131, 101))),
+                                Values(cv::Size(53, 41)),
+                                Values(0.05))); // error within 0.05 units
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -225,3 +225,14 @@ ConvertDepthComputation::ConvertDepthComputation(test::Mat inMat, test::Mat outM
                                })
 {}
 
+NormalizeComputation::NormalizeComputation(test::Mat inMat, test::Mat outMat, float mean, float scale)
+    : FluidComputation(new Priv{ [mean, scale]()-> cv::GComputation {
+                                    cv::GMat in;
+                                    cv::GMat out = InferenceEngine::gapi::Normalize::on(in, mean, scale, CV_32F);
+                                    return cv::GComputation(cv::GIn(in), cv::GOut(out));
+                                 }()
+                               , {to_own(inMat)}
+                               , {to_own(outMat)}
+                               })
+{}
+
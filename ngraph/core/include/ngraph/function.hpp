@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -210,6 +211,14 @@ namespace ngraph
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        /// \brief Marks the cached topological order as stale, must be called on every change of
+        /// the results, sinks and parameters lists
+        void invalidate_topological_cache() const;
+
+        // The ordered ops are sorted again only after an edit of the graph, the cache is shared with
+        // the nodes of the function which drop it when their inputs are changed
+        std::shared_ptr<TopologicalCache> m_topological_cache;
+
         ResultVector m_results;
 
         // List of the nodes with side effect in graph.
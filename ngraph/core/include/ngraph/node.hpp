@@ -22,6 +22,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -59,6 +60,7 @@ namespace ngraph
     class Node;
 
     class Function;
+    class TopologicalCache;
 
     namespace runtime
     {
@@ -134,6 +136,9 @@ namespace ngraph
         // For access to m_outputs.
         friend class descriptor::Input;
 
+        // For access to the topological cache flags.
+        friend class Function;
+
         // For access to m_inputs and m_outputs.
         template <typename NodeType>
         friend class Input;
@@ -494,6 +499,14 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // Topological orders cached by the functions containing the node, they are dropped when
+        // the node inputs or control dependencies are changed. The list is guarded by the mutex, as
+        // the orders are cached by the const Function::get_ordered_ops of shared functions
+        std::vector<std::weak_ptr<TopologicalCache>> m_topological_caches;
+        std::mutex m_topological_caches_mutex;
+
+        void add_topological_cache(const std::shared_ptr<TopologicalCache>& cache);
+        void invalidate_topological_caches();
     };
 
     using NodeTypeInfo = Node::type_info_t;
@@ -21,6 +21,7 @@
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -95,6 +96,79 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                template <typename T, typename U, typename Functor>
+                inline void
+                    elementwise_binop(const T* arg0, const T* arg1, U* out, size_t count, Functor f)
+                {
+                    parallel_for(count, parallel_grain_size, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i)
+                            out[i] = f(arg0[i], arg1[i]);
+                    });
+                }
+            }
+
+            template <typename T, typename U, typename Functor>
+            void autobroadcast_binop(const T* arg0,
+                                     const T* arg1,
+                                     U* out,
+                                     const Shape& arg0_shape,
+                                     const Shape& arg1_shape,
+                                     const op::AutoBroadcastSpec& broadcast_spec,
+                                     Functor elementwise_functor);
+
+            namespace internal
+            {
+                /// \brief Splits large numpy broadcasted binop along the outermost output
+                ///        dimension and processes the slices in parallel.
+                ///
+                /// \return false if the output is too small to be processed in parallel.
+                template <typename T, typename U, typename Functor>
+                bool parallel_numpy_autobroadcast_binop(const T* arg0,
+                                                        const T* arg1,
+                                                        U* out,
+                                                        const Shape& arg0_shape,
+                                                        const Shape& arg1_shape,
+                                                        Functor elementwise_functor)
+                {
+                    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                    // equal shapes are processed as flat arrays
+                    if (rank < 2 || arg0_shape == arg1_shape || get_parallel_concurrency() == 1)
+                        return false;
+
+                    Shape shape0(rank - arg0_shape.size(), 1);
+                    shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+                    Shape shape1(rank - arg1_shape.size(), 1);
+                    shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+
+                    const size_t outer = std::max(shape0[0], shape1[0]);
+                    const Shape inner_shape0(shape0.begin() + 1, shape0.end());
+                    const Shape inner_shape1(shape1.begin() + 1, shape1.end());
+                    size_t inner_out = 1;
+                    for (size_t i = 0; i < inner_shape0.size(); ++i)
+                        inner_out *= std::max(inner_shape0[i], inner_shape1[i]);
+
+                    if (outer < 2 || outer * inner_out < 2 * parallel_grain_size)
+                        return false;
+
+                    const size_t step0 = shape0[0] == 1 ? 0 : shape_size(inner_shape0);
+                    const size_t step1 = shape1[0] == 1 ? 0 : shape_size(inner_shape1);
+                    const size_t min_chunk =
+                        std::max<size_t>(1, parallel_grain_size / std::max<size_t>(1, inner_out));
+                    parallel_for(outer, min_chunk, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            autobroadcast_binop(arg0 + i * step0,
+                                                arg1 + i * step1,
+                                                out + i * inner_out,
+                                                inner_shape0,
+                                                inner_shape1,
+                                                op::AutoBroadcastType::NUMPY,
+                                                elementwise_functor);
+                        }
+                    });
+                    return true;
+                }
             }
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -126,12 +200,15 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    internal::elementwise_binop(
+                        arg0, arg1, out, shape_size(arg0_shape), elementwise_functor);
                     break;
                 case op::AutoBroadcastType::NUMPY:
+                    if (internal::parallel_numpy_autobroadcast_binop(
+                            arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor))
+                    {
+                        break;
+                    }
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
                     // procedure is as follows:
                     //
@@ -205,8 +282,8 @@ namespace ngraph
 
                         if (axis == 0)
                         {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            internal::elementwise_binop(
+                                arg0, arg1, out, strides0[0], elementwise_functor);
                         }
                         else if (strides0[axis] == 1 &&
                                  value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
@@ -21,6 +21,7 @@
 #include "ngraph/coordinate_range.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "utils/parallel.hpp"
 #include "utils/span.hpp"
 
 namespace ngraph
@@ -31,12 +32,6 @@ namespace ngraph
         {
             namespace
             {
-                template <typename Container>
-                Shape to_shape(const Container& c)
-                {
-                    return Shape(begin(c), end(c));
-                }
-
                 template <typename Container>
                 std::vector<size_t>
                     join(const Container& c1, const Container& c2, const Container& c3)
@@ -52,8 +47,6 @@ namespace ngraph
                     std::copy(begin(c3), end(c3), std::back_inserter(ret));
                     return ret;
                 }
-
-                const auto only_one = [] { return coordinates::index(Shape{1}); };
             } // namespace
             template <typename T, typename U>
             void gather(const T* const params,
@@ -85,50 +78,34 @@ namespace ngraph
 
                 const auto copy_size = shape_size(remainder_part_shape);
 
-                const size_t copy_round_in_batch =
-                    indices_shape.size() > 1
-                        ? shape_size(span(indices_shape.data(), indices_shape.size() - 1))
-                        : 1;
-                const size_t round_batch_offset = indices_shape.empty() ? 1 : indices_shape.back();
+                const size_t indices_count = shape_size(indices_shape);
 
-                auto dst = out;
+                const size_t outer_size = shape_size(params_axes_part);
 
-                auto gather_range = params_axes_part.empty()
-                                        ? only_one()
-                                        : coordinates::index(to_shape(params_axes_part));
-                for (auto i : gather_range)
-                {
-                    auto batch_index = i.begin_index;
-                    for (size_t batch = 0; batch != i.element_number;
-                         batch_index += i.step, ++batch)
+                assert(!batch_shape.empty());
+
+                // every (outer index, gathered index) pair copies an independent row of
+                // copy_size elements to the output
+                const size_t min_chunk =
+                    std::max<size_t>(1, parallel_grain_size / std::max<size_t>(1, copy_size));
+                parallel_for(outer_size * indices_count, min_chunk, [&](size_t begin, size_t end) {
+                    for (size_t row = begin; row != end; ++row)
                     {
-                        const auto batch_offset = batch_index * batch_size;
+                        const auto batch_offset = (row / indices_count) * batch_size;
                         assert(batch_offset < shape_size(params_shape));
-                        for (size_t round = 0; round != copy_round_in_batch; ++round)
-                        {
-                            const U* input_indices = indices + round * round_batch_offset;
-                            const auto indices_no =
-                                indices_shape.empty() ? 1 : indices_shape.back();
-
-                            assert(!batch_shape.empty());
-                            for (size_t ii = 0; ii != indices_no; ++ii)
-                            {
-                                const auto positive_input_index =
-                                    input_indices[ii] < 0 ? batch_shape.front() + input_indices[ii]
-                                                          : input_indices[ii];
-
-                                const auto src_offset =
-                                    batch_offset + copy_size * positive_input_index;
-
-                                const auto src_begin = next(params, src_offset);
-                                const auto src_end = next(src_begin, copy_size);
-
-                                std::copy(src_begin, src_end, dst);
-                                dst += copy_size;
-                            }
-                        }
+
+                        const U input_index = indices[row % indices_count];
+                        const auto positive_input_index =
+                            input_index < 0 ? batch_shape.front() + input_index : input_index;
+
+                        const auto src_offset = batch_offset + copy_size * positive_input_index;
+
+                        const auto src_begin = next(params, src_offset);
+                        const auto src_end = next(src_begin, copy_size);
+
+                        std::copy(src_begin, src_end, next(out, row * copy_size));
                     }
-                }
+                });
             }
         } // namespace reference
     }     // namespace runtime
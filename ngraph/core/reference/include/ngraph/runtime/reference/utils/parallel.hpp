@@ -0,0 +1,47 @@
+//*****************************************************************************
+// Copyright 2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Minimal number of elements processed by one thread of a parallel kernel.
+            ///        Smaller tensors are processed on the calling thread.
+            constexpr size_t parallel_grain_size = 32768;
+
+            /// \brief Returns the number of threads parallel_for can use from the calling
+            ///        thread. Threads which are running a parallel_for chunk get 1, so nested
+            ///        parallel_for calls are executed sequentially.
+            size_t get_parallel_concurrency();
+
+            /// \brief Splits [0, work_amount) into contiguous chunks of at least min_chunk
+            ///        items and calls func(begin, end) for every chunk. The chunks are processed
+            ///        by the calling thread and the threads of a pool created on the first call,
+            ///        no more threads than chunks are involved.
+            ///        The first exception thrown by func is rethrown to the caller.
+            void parallel_for(size_t work_amount,
+                              size_t min_chunk,
+                              const std::function<void(size_t, size_t)>& func);
+        }
+    }
+}
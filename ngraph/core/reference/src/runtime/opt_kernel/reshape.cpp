@@ -14,11 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <stdio.h>
+#include <vector>
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
@@ -245,6 +249,81 @@ namespace
             }
         }
     }
+
+    template <typename T>
+    void copy_strided_row(const char* in, char* out, size_t count, size_t in_stride)
+    {
+        auto src = reinterpret_cast<const T*>(in);
+        auto dst = reinterpret_cast<T*>(out);
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[i] = src[i * in_stride];
+        }
+    }
+
+    // Walks the output in rows of the innermost output dimension, so rows can be
+    // processed by different threads and every row is copied by a typed strided loop
+    void reshape_parallel(const char* in,
+                          char* out,
+                          const Shape& in_shape,
+                          const AxisVector& in_axis_order,
+                          size_t elem_size)
+    {
+        const size_t rank = in_shape.size();
+        std::vector<size_t> in_strides(rank, 1);
+        for (size_t i = rank - 1; i > 0; --i)
+        {
+            in_strides[i - 1] = in_strides[i] * in_shape[i];
+        }
+
+        std::vector<size_t> size(rank);
+        std::vector<size_t> stride(rank);
+        for (size_t i = 0; i < rank; i++)
+        {
+            size[i] = in_shape[in_axis_order[i]];
+            stride[i] = in_strides[in_axis_order[i]];
+        }
+
+        const size_t row_size = size.back();
+        const size_t row_stride = stride.back();
+        const size_t rows = shape_size(in_shape) / row_size;
+        const size_t min_chunk = std::max<size_t>(
+            1, runtime::reference::parallel_grain_size / std::max<size_t>(1, row_size));
+
+        runtime::reference::parallel_for(rows, min_chunk, [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; ++row)
+            {
+                size_t in_offset = 0;
+                for (size_t i = rank - 1, idx = row; i > 0; --i)
+                {
+                    in_offset += (idx % size[i - 1]) * stride[i - 1];
+                    idx /= size[i - 1];
+                }
+
+                const char* src = in + in_offset * elem_size;
+                char* dst = out + row * row_size * elem_size;
+                if (row_stride == 1)
+                {
+                    memcpy(dst, src, row_size * elem_size);
+                    continue;
+                }
+                switch (elem_size)
+                {
+                case 1: copy_strided_row<uint8_t>(src, dst, row_size, row_stride); break;
+                case 2: copy_strided_row<uint16_t>(src, dst, row_size, row_stride); break;
+                case 4: copy_strided_row<uint32_t>(src, dst, row_size, row_stride); break;
+                case 8: copy_strided_row<uint64_t>(src, dst, row_size, row_stride); break;
+                default:
+                    for (size_t i = 0; i < row_size; ++i)
+                    {
+                        memcpy(dst + i * elem_size,
+                               src + i * row_stride * elem_size,
+                               elem_size);
+                    }
+                }
+            }
+        });
+    }
 }
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
@@ -253,6 +332,13 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
+    if (in_shape.size() > 1 && shape_size(in_shape) >= 2 * reference::parallel_grain_size &&
+        reference::get_parallel_concurrency() > 1)
+    {
+        reshape_parallel(in, out, in_shape, in_axis_order, elem_size);
+        return;
+    }
+
     switch (in_shape.size())
     {
     case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
@@ -0,0 +1,245 @@
+//*****************************************************************************
+// Copyright 2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    thread_local bool in_parallel_region = false;
+
+    struct ParallelRegionGuard
+    {
+        ParallelRegionGuard()
+            : m_prev(in_parallel_region)
+        {
+            in_parallel_region = true;
+        }
+        ~ParallelRegionGuard() { in_parallel_region = m_prev; }
+        bool m_prev;
+    };
+
+    size_t get_hardware_concurrency()
+    {
+        static const size_t concurrency =
+            std::max<size_t>(1, static_cast<size_t>(std::thread::hardware_concurrency()));
+        return concurrency;
+    }
+
+    // Chunks of one parallel_for call. The calling thread and the pool threads take
+    // chunks until all of them are claimed, so the call doesn't wait for busy threads.
+    struct ParallelJob
+    {
+        ParallelJob(size_t num_chunks, const std::function<void(size_t)>& run_chunk)
+            : m_num_chunks(num_chunks)
+            , m_run_chunk(run_chunk)
+        {
+        }
+
+        void process()
+        {
+            ParallelRegionGuard guard;
+            size_t processed = 0;
+            for (size_t chunk = m_next_chunk++; chunk < m_num_chunks; chunk = m_next_chunk++)
+            {
+                m_run_chunk(chunk);
+                ++processed;
+            }
+            if (processed != 0 && (m_processed += processed) == m_num_chunks)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done.notify_all();
+            }
+        }
+
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this] { return m_processed == m_num_chunks; });
+        }
+
+        const size_t m_num_chunks;
+        // is called only for claimed chunks, so it is alive while the caller waits for them
+        const std::function<void(size_t)>& m_run_chunk;
+        std::atomic<size_t> m_next_chunk{0};
+        std::atomic<size_t> m_processed{0};
+        std::mutex m_mutex;
+        std::condition_variable m_done;
+    };
+
+    // Threads are created once and reused by all parallel_for calls
+    class ThreadPool
+    {
+    public:
+        static ThreadPool& get()
+        {
+            static ThreadPool pool(get_hardware_concurrency() - 1);
+            return pool;
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopped = true;
+            }
+            m_queue_cond_var.notify_all();
+            for (auto& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        size_t size() const { return m_threads.size(); }
+
+        void submit(const std::shared_ptr<ParallelJob>& job, size_t num_helpers)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (size_t i = 0; i < num_helpers; ++i)
+                {
+                    m_jobs.push_back(job);
+                }
+            }
+            if (num_helpers == 1)
+            {
+                m_queue_cond_var.notify_one();
+            }
+            else
+            {
+                m_queue_cond_var.notify_all();
+            }
+        }
+
+    private:
+        explicit ThreadPool(size_t num_threads)
+        {
+            m_threads.reserve(num_threads);
+            for (size_t i = 0; i < num_threads; ++i)
+            {
+                try
+                {
+                    m_threads.emplace_back([this] { worker(); });
+                }
+                catch (const std::system_error&)
+                {
+                    // out of threads, the pool works with the ones already created
+                    break;
+                }
+            }
+        }
+
+        void worker()
+        {
+            while (true)
+            {
+                std::shared_ptr<ParallelJob> job;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_queue_cond_var.wait(lock, [this] { return m_stopped || !m_jobs.empty(); });
+                    if (m_jobs.empty())
+                    {
+                        return;
+                    }
+                    job = std::move(m_jobs.front());
+                    m_jobs.pop_front();
+                }
+                job->process();
+            }
+        }
+
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_queue_cond_var;
+        std::deque<std::shared_ptr<ParallelJob>> m_jobs;
+        bool m_stopped = false;
+    };
+}
+
+size_t runtime::reference::get_parallel_concurrency()
+{
+    if (in_parallel_region)
+    {
+        return 1;
+    }
+    return get_hardware_concurrency();
+}
+
+void runtime::reference::parallel_for(size_t work_amount,
+                                      size_t min_chunk,
+                                      const std::function<void(size_t, size_t)>& func)
+{
+    if (work_amount == 0)
+    {
+        return;
+    }
+
+    const size_t max_chunks = std::max<size_t>(1, work_amount / std::max<size_t>(1, min_chunk));
+    size_t num_chunks = std::min(get_parallel_concurrency(), max_chunks);
+    if (num_chunks > 1)
+    {
+        num_chunks = std::min(num_chunks, ThreadPool::get().size() + 1);
+    }
+    if (num_chunks == 1)
+    {
+        func(0, work_amount);
+        return;
+    }
+
+    const size_t chunk_size = (work_amount + num_chunks - 1) / num_chunks;
+    std::vector<std::exception_ptr> errors(num_chunks);
+    const std::function<void(size_t)> run_chunk = [&](size_t chunk) {
+        try
+        {
+            const size_t begin = chunk * chunk_size;
+            const size_t end = std::min(work_amount, begin + chunk_size);
+            if (begin < end)
+            {
+                func(begin, end);
+            }
+        }
+        catch (...)
+        {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    // the pool threads which find all the chunks claimed return to the pool at once
+    auto job = std::make_shared<ParallelJob>(num_chunks, run_chunk);
+    ThreadPool::get().submit(job, num_chunks - 1);
+    job->process();
+    job->wait();
+
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
@@ -57,6 +57,9 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    // the cached orders are dropped after the edit, so the nodes released with them are no
+    // longer referenced by this input
+    m_node->invalidate_topological_caches();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -25,6 +25,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/op_types.hpp"
 #include "ngraph/validation_util.hpp"
+#include "topological_cache.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -41,6 +42,7 @@ Function::Function(const ResultVector& results,
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_topological_cache(std::make_shared<TopologicalCache>())
 {
     check_all_parameters_registered();
 }
@@ -53,6 +55,7 @@ Function::Function(const OutputVector& results,
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_topological_cache(std::make_shared<TopologicalCache>())
 {
     check_all_parameters_registered();
 }
@@ -65,6 +68,7 @@ Function::Function(const NodeVector& results,
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_topological_cache(std::make_shared<TopologicalCache>())
 {
     check_all_parameters_registered();
 }
@@ -86,6 +90,7 @@ Function::Function(const ResultVector& results,
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_topological_cache(std::make_shared<TopologicalCache>())
 {
     check_all_parameters_registered();
 }
@@ -159,6 +164,14 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    std::lock_guard<std::mutex> lock(m_topological_cache->mutex);
+    if (m_topological_cache->valid)
+    {
+        OV_ITT_COUNTER_INCREMENT(itt::domains::nGraph, "Function::get_ordered_ops cache hits");
+        return m_topological_cache->ordered_ops;
+    }
+    OV_ITT_COUNTER_INCREMENT(itt::domains::nGraph, "Function::get_ordered_ops sorts");
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -173,7 +186,19 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto& ordered_ops = m_topological_cache->ordered_ops;
+    ordered_ops = m_topological_sorter(nodes);
+    for (auto& node : ordered_ops)
+    {
+        node->add_topological_cache(m_topological_cache);
+    }
+    m_topological_cache->valid = true;
+    return ordered_ops;
+}
+
+void Function::invalidate_topological_cache() const
+{
+    m_topological_cache->invalidate();
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -337,11 +362,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_topological_cache();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_topological_cache();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -411,12 +438,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_topological_cache();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -425,11 +454,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -439,6 +470,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_topological_cache();
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -455,6 +487,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    invalidate_topological_cache();
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -464,6 +497,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    invalidate_topological_cache();
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
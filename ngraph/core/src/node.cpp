@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
 #include <ngraph/validation_util.hpp>
 #include <sstream>
@@ -28,6 +29,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "topological_cache.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -58,6 +60,7 @@ Node::Node(const Node& node)
 
 Node& Node::operator=(const Node& node)
 {
+    invalidate_topological_caches();
     this->m_control_dependents = node.m_control_dependents;
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
@@ -194,6 +197,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    invalidate_topological_caches();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -484,6 +488,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        invalidate_topological_caches();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -521,6 +526,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            invalidate_topological_caches();
             m_control_dependencies.erase(it);
         }
     }
@@ -543,9 +549,54 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
+    if (!m_control_dependencies.empty())
+    {
+        invalidate_topological_caches();
+    }
     m_control_dependencies.clear();
 }
 
+void Node::add_topological_cache(const std::shared_ptr<TopologicalCache>& cache)
+{
+    std::lock_guard<std::mutex> lock(m_topological_caches_mutex);
+    // caches of the destroyed functions are dropped here, so the list doesn't grow
+    bool registered = false;
+    m_topological_caches.erase(
+        std::remove_if(m_topological_caches.begin(),
+                       m_topological_caches.end(),
+                       [&](const std::weak_ptr<TopologicalCache>& registered_cache) {
+                           auto locked_cache = registered_cache.lock();
+                           registered = registered || locked_cache == cache;
+                           return locked_cache == nullptr;
+                       }),
+        m_topological_caches.end());
+    if (!registered)
+    {
+        m_topological_caches.push_back(cache);
+    }
+}
+
+void Node::invalidate_topological_caches()
+{
+    std::vector<std::shared_ptr<TopologicalCache>> caches;
+    {
+        std::lock_guard<std::mutex> lock(m_topological_caches_mutex);
+        for (auto& cache : m_topological_caches)
+        {
+            if (auto locked_cache = cache.lock())
+            {
+                caches.push_back(locked_cache);
+            }
+        }
+    }
+    // the caches are invalidated out of the lock: get_ordered_ops registers the nodes while it
+    // holds the cache mutex, and the released nodes may be the users of this one
+    for (auto& cache : caches)
+    {
+        cache->invalidate();
+    }
+}
+
 void Node::clear_control_dependents()
 {
     while (!m_control_dependents.empty())
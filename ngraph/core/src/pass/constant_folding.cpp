@@ -16,6 +16,8 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 #include <ngraph/op/constant.hpp>
+#include <ngraph/runtime/reference/utils/parallel.hpp>
+#include <unordered_map>
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 
@@ -24,56 +26,158 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    // Splits topologically ordered nodes into levels, so every node depends only on
+    // nodes of the previous levels and nodes of one level can be folded independently
+    std::vector<NodeVector> split_by_levels(const NodeVector& ordered_ops)
+    {
+        std::unordered_map<const Node*, size_t> node_levels;
+        std::vector<NodeVector> levels;
+        for (const auto& node : ordered_ops)
+        {
+            size_t level = 0;
+            auto update_level = [&](const Node* dependency) {
+                auto it = node_levels.find(dependency);
+                if (it != node_levels.end())
+                {
+                    level = std::max(level, it->second + 1);
+                }
+            };
+            for (const auto& input : node->input_values())
+            {
+                update_level(input.get_node());
+            }
+            for (const auto& dependency : node->get_control_dependencies())
+            {
+                update_level(dependency.get());
+            }
+
+            node_levels[node.get()] = level;
+            if (levels.size() <= level)
+            {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(node);
+        }
+        return levels;
+    }
+
+    size_t elements_count(const PartialShape& shape)
+    {
+        return shape.is_static() ? shape_size(shape.to_shape()) : 0;
+    }
+
+    // Small nodes with constant inputs are folded concurrently with each other. Large ones
+    // are folded one by one, so their reference kernels can use all the threads.
+    bool is_concurrently_foldable(const std::shared_ptr<Node>& node)
+    {
+        if (node->get_input_size() == 0 || is_type<op::Constant>(node))
+        {
+            return false;
+        }
+
+        size_t work = 0;
+        for (const auto& input : node->input_values())
+        {
+            if (!is_type<op::Constant>(input.get_node()))
+            {
+                return false;
+            }
+            work += elements_count(input.get_partial_shape());
+        }
+        for (const auto& output : node->outputs())
+        {
+            work += elements_count(output.get_partial_shape());
+        }
+        return work < runtime::reference::parallel_grain_size;
+    }
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = pre_calculated_values_folding(f);
 
-    for (const auto& node : f->get_ordered_ops())
+    for (const auto& level : split_by_levels(f->get_ordered_ops()))
     {
         if (rewritten)
         {
-            node->validate_and_infer_types();
+            for (const auto& node : level)
+            {
+                node->validate_and_infer_types();
+            }
         }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+        std::vector<OutputVector> level_replacements(level.size());
+        std::vector<char> folded(level.size(), false);
+        std::vector<size_t> concurrent;
+        for (size_t i = 0; i < level.size(); ++i)
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
+            level_replacements[i].resize(level[i]->get_output_size());
+            if (is_concurrently_foldable(level[i]))
+            {
+                concurrent.push_back(i);
+            }
+            else
+            {
+                folded[i] =
+                    level[i]->constant_fold(level_replacements[i], level[i]->input_values());
+            }
+        }
+        runtime::reference::parallel_for(concurrent.size(), 16, [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j)
+            {
+                const auto& node = level[concurrent[j]];
+                folded[concurrent[j]] =
+                    node->constant_fold(level_replacements[concurrent[j]], node->input_values());
+            }
+        });
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+        // the graph is modified sequentially in the topological order
+        for (size_t n = 0; n < level.size(); ++n)
+        {
+            const auto& node = level[n];
+            const auto& replacements = level_replacements[n];
+            if (folded[n])
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+
+                for (size_t i = 0; i < replacements.size(); ++i)
                 {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
+                    auto node_output = node->output(i);
+                    auto replacement = replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement))
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+                        if (replacements.size() == 1)
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name());
+                        }
+                        else
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name() + "." + std::to_string(i));
+                        }
+                        node_output.replace(replacement);
+                        // Propagate runtime info attributes to replacement consumer nodes
+                        copy_runtime_info_to_target_inputs(node, replacement);
 
-                    rewritten = true;
+                        rewritten = true;
+                    }
                 }
             }
-        }
-        else
-        {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            else
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
+                // recursively constant fold operators containing subgraphs
+                // (ie: TensorIterator, Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    if (const auto& sub_graph = sub_graph_node->get_function())
+                    {
+                        rewritten |= run_on_function(sub_graph);
+                    }
                 }
             }
         }
@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    /// \brief The topological order cached by a function. It is shared with the nodes of the
+    /// function, which drop it when their inputs or control dependencies are changed.
+    class TopologicalCache
+    {
+    public:
+        /// \brief Releases the cached order, so the nodes removed from the graph are not kept
+        /// alive until the next sort
+        void invalidate()
+        {
+            std::vector<std::shared_ptr<Node>> released;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                valid = false;
+                released.swap(ordered_ops);
+            }
+            // the nodes are destroyed out of the lock, as their destructors may edit the graph
+        }
+
+        std::mutex mutex;
+        bool valid{false};
+        std::vector<std::shared_ptr<Node>> ordered_ops;
+    };
+}
@@ -23,6 +23,7 @@
 #include "util/test_tools.hpp"
 
 #include <memory>
+#include <thread>
 #include <util/type_prop.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -455,4 +456,95 @@ TEST(build_graph, build_graph_with_remove_parameter_indexing)
     EXPECT_EQ(nodes.size(), 9);
 
     f->validate_nodes_and_infer_types();
-}
\ No newline at end of file
+}
+TEST(build_graph, ordered_ops_cache_follows_graph_edits)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto position = [&f](const shared_ptr<Node>& node) {
+        auto ops = f->get_ordered_ops();
+        return std::distance(ops.begin(), std::find(ops.begin(), ops.end(), node));
+    };
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 3);
+    EXPECT_EQ(ops, f->get_ordered_ops());
+
+    // new node inserted by changing an input
+    auto abs = make_shared<op::Abs>(arg);
+    relu->input(0).replace_source_output(abs->output(0));
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+    EXPECT_LT(position(abs), position(relu));
+
+    // node replaced by redirecting its consumers
+    auto neg = make_shared<op::Negative>(abs);
+    replace_node(relu, neg);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 4);
+    EXPECT_EQ(std::find(ops.begin(), ops.end(), relu), ops.end());
+    EXPECT_LT(position(neg), position(res));
+
+    // node reachable through a control dependency only
+    auto constant = op::Constant::create(element::f32, Shape{}, {0});
+    neg->add_control_dependency(constant);
+    EXPECT_EQ(f->get_ordered_ops().size(), 5);
+    EXPECT_LT(position(constant), position(neg));
+    neg->remove_control_dependency(constant);
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+
+    // results list changed
+    auto res2 = make_shared<op::Result>(make_shared<op::Sqrt>(arg));
+    f->add_results(ResultVector{res2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 6);
+    f->remove_result(res2);
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+}
+
+TEST(build_graph, ordered_ops_cache_releases_removed_nodes)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+
+    std::weak_ptr<Node> removed = relu;
+    replace_node(relu, make_shared<op::Abs>(arg));
+    relu.reset();
+    // the node is not kept by the stale order until the next sort
+    EXPECT_TRUE(removed.expired());
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(build_graph, ordered_ops_cache_of_functions_sharing_nodes)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto f1 = make_shared<Function>(ResultVector{make_shared<op::Result>(relu)},
+                                    ParameterVector{arg});
+    auto f2 = make_shared<Function>(ResultVector{make_shared<op::Result>(relu)},
+                                    ParameterVector{arg});
+
+    // the nodes register the caches of both functions at the same time
+    std::vector<std::thread> threads;
+    for (auto& f : {f1, f2})
+    {
+        threads.emplace_back([f] {
+            for (int i = 0; i < 100; i++)
+            {
+                EXPECT_EQ(f->get_ordered_ops().size(), 3);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    relu->input(0).replace_source_output(make_shared<op::Abs>(arg));
+    EXPECT_EQ(f1->get_ordered_ops().size(), 4);
+    EXPECT_EQ(f2->get_ordered_ops().size(), 4);
+}
@@ -3168,3 +3168,69 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, const_independent_branches)
+{
+    // small branches are folded concurrently, the large one uses parallel reference kernels
+    const size_t num_branches = 64;
+    OutputVector branches;
+    for (size_t i = 0; i < num_branches; ++i)
+    {
+        auto a = op::Constant::create(
+            element::f32, Shape{2, 2}, vector<float>(4, static_cast<float>(i)));
+        auto b = op::Constant::create(element::f32, Shape{2, 1}, vector<float>{1, 2});
+        auto mul = make_shared<op::v1::Multiply>(a, b);
+        branches.push_back(make_shared<op::v1::Add>(mul, b));
+    }
+    auto concat = make_shared<op::Concat>(branches, 0);
+
+    const Shape weights_shape{128, 64, 3, 3};
+    vector<float16> weights_values(shape_size(weights_shape));
+    for (size_t i = 0; i < weights_values.size(); ++i)
+    {
+        weights_values[i] = float16(static_cast<float>(i % 100));
+    }
+    vector<float> scale_values(weights_shape[0]);
+    for (size_t i = 0; i < scale_values.size(); ++i)
+    {
+        scale_values[i] = static_cast<float>(i % 7 + 1);
+    }
+    auto weights = op::Constant::create(element::f16, weights_shape, weights_values);
+    auto convert = make_shared<op::Convert>(weights, element::f32);
+    auto scale = op::Constant::create(element::f32, Shape{128, 1, 1, 1}, scale_values);
+    auto scaled = make_shared<op::v1::Multiply>(convert, scale);
+
+    auto f = make_shared<Function>(NodeVector{concat, scaled}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+
+    auto concat_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(concat_const);
+    vector<float> concat_expected;
+    for (size_t i = 0; i < num_branches; ++i)
+    {
+        concat_expected.insert(concat_expected.end(), 2, static_cast<float>(i + 1));
+        concat_expected.insert(concat_expected.end(), 2, static_cast<float>(2 * i + 2));
+    }
+    ASSERT_EQ(concat_expected, concat_const->get_vector<float>());
+
+    auto scaled_const =
+        as_type_ptr<op::Constant>(f->get_results().at(1)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(scaled_const);
+    const size_t channel_size = shape_size(weights_shape) / weights_shape[0];
+    vector<float> scaled_expected(shape_size(weights_shape));
+    for (size_t i = 0; i < scaled_expected.size(); ++i)
+    {
+        scaled_expected[i] = static_cast<float>(i % 100) * scale_values[i / channel_size];
+    }
+    ASSERT_EQ(scaled_expected, scaled_const->get_vector<float>());
+}
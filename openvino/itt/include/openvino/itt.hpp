@@ -43,6 +43,13 @@ namespace openvino
          */
         typedef struct handle_ {} *handle_t;
 
+        /**
+         * @typedef counter_t
+         * @ingroup ie_dev_profiling
+         * @brief A counter of events which is displayed in Intel VTune as a part of a domain.
+         */
+        typedef struct counter_ {} *counter_t;
+
 /**
  * @cond
  */
@@ -53,6 +60,8 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            counter_t counter(domain_t d, char const* name);
+            void counterIncrement(counter_t c);
         }
 /**
  * @endcond
@@ -345,5 +354,18 @@ inline openvino::itt::domain_t domainName() noexcept
  */
 #define OV_ITT_TASK_SKIP(chainId) chainId.skip();
 
+/**
+ * @def OV_ITT_COUNTER_INCREMENT(domain, counterName)
+ * @ingroup ie_dev_profiling
+ * @brief Increments the counter with a given name, e.g. to compare how often a cache is hit or missed.
+ * @param domainName [in] Known at compile time name of module or library (the domain name).
+ * @param counterName [in] Known at compile time name of the counter.
+ */
+#define OV_ITT_COUNTER_INCREMENT(domain, counterName)                                               \
+{                                                                                                   \
+    static auto OV_PP_CAT(ittCounter, __LINE__) = openvino::itt::internal::counter(domain(), counterName); \
+    openvino::itt::internal::counterIncrement(OV_PP_CAT(ittCounter, __LINE__));                     \
+}
+
     } // namespace itt
 } // namespace openvino
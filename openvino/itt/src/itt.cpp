@@ -60,6 +60,15 @@ void threadName(const char* name) {
     __itt_thread_set_name(name);
 }
 
+counter_t counter(domain_t d, char const* name) {
+    auto itt_domain = reinterpret_cast<__itt_domain*>(d);
+    return reinterpret_cast<counter_t>(__itt_counter_create(name, itt_domain ? itt_domain->nameA : nullptr));
+}
+
+void counterIncrement(counter_t c) {
+    __itt_counter_inc(reinterpret_cast<__itt_counter>(c));
+}
+
 #else
 
 domain_t domain(char const *) { return nullptr; }
@@ -72,6 +81,10 @@ void taskEnd(domain_t) { }
 
 void threadName(const char *) { }
 
+counter_t counter(domain_t, char const *) { return nullptr; }
+
+void counterIncrement(counter_t) { }
+
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal